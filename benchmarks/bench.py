@@ -0,0 +1,414 @@
+# -*- coding: utf-8 -*-
+
+# Copyright (c) 2023, J. D. Mitchell
+#
+# Distributed under the terms of the GPL license version 3.
+#
+# The full license is in the file LICENSE, distributed with this software.
+
+# pylint: disable=no-name-in-module, invalid-name
+
+"""
+This module contains the benchmarks for libsemigroups_pybind11.
+
+There are two kinds of benchmark: those in the group "overhead" measure the
+cost of a single call into the extension (such as a product of two Transf16),
+and those in the group "engine" measure the time taken to fully run one of
+the algorithms (ToddCoxeter, KnuthBendix, Sims1) on one of the presentations
+in libsemigroups_pybind11.fpsemigroup.
+
+Run ``python benchmarks/bench.py --help`` (or ``make bench``) for details. The
+results are written as JSON, so that they can be compared across versions
+using ``python benchmarks/bench.py --compare OLD.json NEW.json``.
+"""
+
+import argparse
+import json
+import platform
+import re
+import statistics
+import sys
+import time
+from datetime import datetime, timezone
+
+try:
+    from importlib.metadata import version as package_version
+except ImportError:  # Python 3.7
+    package_version = None
+
+from libsemigroups_pybind11 import (
+    FroidurePin,
+    KnuthBendix,
+    Presentation,
+    ReportGuard,
+    Sims1,
+    ToddCoxeter,
+    Transf,
+    congruence_kind,
+    libsemigroups_version,
+    presentation,
+    wislo,
+)
+from libsemigroups_pybind11.fpsemigroup import (
+    full_transformation_monoid,
+    make,
+    partition_monoid,
+    stellar_monoid,
+    symmetric_group,
+    symmetric_inverse_monoid,
+)
+
+SCHEMA_VERSION = 1
+BENCHMARKS = []
+
+
+def benchmark(group, number=1, repeat=5):
+    """
+    Register the decorated function as a benchmark.
+
+    The decorated function is called once with no arguments, and returns the
+    nullary function to be timed. Creating the data used by a benchmark is
+    therefore not included in its timings. Each of the ``repeat`` timings
+    consists of ``number`` calls to the returned function.
+    """
+
+    def register(setup):
+        BENCHMARKS.append(
+            {
+                "name": setup.__name__,
+                "group": group,
+                "setup": setup,
+                "number": number,
+                "repeat": repeat,
+            }
+        )
+        return setup
+
+    return register
+
+
+def semigroup_presentation(p):
+    """
+    Modifies the monoid presentation p in-place to be a semigroup
+    presentation, by adjoining a new letter for the identity, and returns the
+    number of letters in the modified presentation.
+    """
+    n = len(p.alphabet())
+    presentation.replace_word(p, [], [n])
+    p.alphabet(n + 1)
+    presentation.add_identity_rules(p, n)
+    p.validate()
+    return n + 1
+
+
+def rules(p):
+    "Returns the rules of the presentation p as a list of pairs."
+    return [(p.rules[i], p.rules[i + 1]) for i in range(0, len(p.rules), 2)]
+
+
+###############################################################################
+# Per-call binding overhead
+###############################################################################
+
+
+@benchmark("overhead", number=100000)
+def transf16_product():
+    x = Transf([1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0])
+    y = Transf([1, 0, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15])
+    return lambda: x * y
+
+
+@benchmark("overhead", number=100000)
+def transf16_images():
+    x = Transf([1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0])
+    return lambda: list(x.images())
+
+
+@benchmark("overhead", number=10000)
+def froidure_pin_current_position():
+    S = FroidurePin(Transf([1, 0, 2, 3, 4]), Transf([1, 2, 3, 4, 0]))
+    S.run()
+    w = S.factorisation(S.size() - 1)
+    return lambda: S.current_position(w)
+
+
+@benchmark("overhead", number=10000)
+def froidure_pin_fast_product():
+    S = FroidurePin(Transf([1, 0, 2, 3, 4]), Transf([1, 2, 3, 4, 0]))
+    S.run()
+    return lambda: S.fast_product(17, 42)
+
+
+@benchmark("overhead", number=100)
+def froidure_pin_iterator():
+    S = FroidurePin(Transf([1, 0, 2, 3, 4]), Transf([1, 2, 3, 4, 0]))
+    S.run()
+    return lambda: sum(1 for _ in S)
+
+
+@benchmark("overhead", number=10000)
+def knuth_bendix_normal_form():
+    p = make(symmetric_group(5))
+    kb = KnuthBendix()
+    kb.set_alphabet(semigroup_presentation(p))
+    for u, v in rules(p):
+        kb.add_rule(u, v)
+    kb.run()
+    w = [0, 1, 2, 3, 0, 1, 2, 3, 0, 1]
+    return lambda: kb.normal_form(w)
+
+
+@benchmark("overhead", number=100)
+def wislo_iterator():
+    return lambda: sum(1 for _ in wislo(3, [0], [0, 0, 0, 0, 0, 0, 0]))
+
+
+@benchmark("overhead", number=10000)
+def presentation_rules():
+    p = make(full_transformation_monoid(4))
+    return lambda: p.rules
+
+
+@benchmark("overhead", number=1000)
+def presentation_copy():
+    p = make(full_transformation_monoid(4))
+    return lambda: Presentation(p)
+
+
+###############################################################################
+# Full runs
+###############################################################################
+
+
+def todd_coxeter(p):
+    "Returns a function enumerating the monoid defined by p."
+    n = semigroup_presentation(p)
+
+    def run():
+        tc = ToddCoxeter(congruence_kind.twosided)
+        tc.set_number_of_generators(n)
+        for u, v in rules(p):
+            tc.add_pair(u, v)
+        return tc.number_of_classes()
+
+    return run
+
+
+def knuth_bendix(p):
+    "Returns a function running Knuth-Bendix on the monoid defined by p."
+    n = semigroup_presentation(p)
+
+    def run():
+        kb = KnuthBendix()
+        kb.set_alphabet(n)
+        for u, v in rules(p):
+            kb.add_rule(u, v)
+        return kb.size()
+
+    return run
+
+
+def sims1(p, n):
+    "Returns a function counting the right congruences of p with n classes."
+
+    def run():
+        return (
+            Sims1(congruence_kind.right).short_rules(p).number_of_congruences(n)
+        )
+
+    return run
+
+
+@benchmark("engine")
+def todd_coxeter_symmetric_group_7():
+    return todd_coxeter(make(symmetric_group(7)))
+
+
+@benchmark("engine")
+def todd_coxeter_full_transformation_monoid_5():
+    return todd_coxeter(make(full_transformation_monoid(5)))
+
+
+@benchmark("engine")
+def todd_coxeter_symmetric_inverse_monoid_5():
+    return todd_coxeter(make(symmetric_inverse_monoid(5)))
+
+
+@benchmark("engine")
+def todd_coxeter_partition_monoid_4():
+    return todd_coxeter(make(partition_monoid(4)))
+
+
+@benchmark("engine")
+def knuth_bendix_symmetric_group_6():
+    return knuth_bendix(make(symmetric_group(6)))
+
+
+@benchmark("engine")
+def knuth_bendix_full_transformation_monoid_4():
+    return knuth_bendix(make(full_transformation_monoid(4)))
+
+
+@benchmark("engine")
+def sims1_stellar_monoid_4():
+    return sims1(make(stellar_monoid(4)), 3)
+
+
+@benchmark("engine")
+def sims1_symmetric_inverse_monoid_3():
+    return sims1(make(symmetric_inverse_monoid(3)), 4)
+
+
+###############################################################################
+# Running and comparing
+###############################################################################
+
+
+def run_benchmark(bench, repeat):
+    "Run the benchmark bench, and return a dict containing the timings."
+    func = bench["setup"]()
+    number = bench["number"]
+    func()  # warm up
+    timings = []
+    for _ in range(repeat or bench["repeat"]):
+        start = time.perf_counter()
+        for _ in range(number):
+            func()
+        timings.append((time.perf_counter() - start) / number)
+    return {
+        "name": bench["name"],
+        "group": bench["group"],
+        "number": number,
+        "repeat": len(timings),
+        "min": min(timings),
+        "median": statistics.median(timings),
+        "max": max(timings),
+        "timings": timings,
+    }
+
+
+def metadata():
+    "Returns a dict describing the environment in which the benchmarks ran."
+    try:
+        pybind11_version = package_version("libsemigroups_pybind11")
+    except Exception:  # pylint: disable=broad-except
+        pybind11_version = "unknown"
+    try:
+        lib_version = libsemigroups_version()
+    except Exception:  # pylint: disable=broad-except
+        lib_version = "unknown"
+    return {
+        "schema_version": SCHEMA_VERSION,
+        "date": datetime.now(timezone.utc).isoformat(),
+        "libsemigroups_pybind11": pybind11_version,
+        "libsemigroups": lib_version,
+        "python": platform.python_version(),
+        "platform": platform.platform(),
+        "machine": platform.machine(),
+    }
+
+
+def format_time(seconds):
+    "Returns a string representation of seconds with a sensible unit."
+    for unit, scale in (("s", 1), ("ms", 1e-3), ("us", 1e-6)):
+        if seconds >= scale:
+            return f"{seconds / scale:.3f}{unit}"
+    return f"{seconds / 1e-9:.1f}ns"
+
+
+def compare(old_file, new_file, threshold):
+    """
+    Print the ratio of the median timings in new_file to those in old_file,
+    and return 1 if any benchmark is slower by more than the given threshold
+    (as a proportion), and 0 otherwise.
+    """
+    with open(old_file, encoding="utf-8") as f:
+        old = {x["name"]: x for x in json.load(f)["results"]}
+    with open(new_file, encoding="utf-8") as f:
+        new = {x["name"]: x for x in json.load(f)["results"]}
+    status = 0
+    for name in sorted(old.keys() & new.keys()):
+        ratio = new[name]["median"] / old[name]["median"]
+        flag = ""
+        if ratio > 1 + threshold:
+            flag = "  <-- slower"
+            status = 1
+        elif ratio < 1 - threshold:
+            flag = "  <-- faster"
+        print(
+            f"{name:50} {format_time(old[name]['median']):>10} "
+            f"{format_time(new[name]['median']):>10} {ratio:6.2f}x{flag}"
+        )
+    for name in sorted(old.keys() ^ new.keys()):
+        print(f"{name:50} only in {old_file if name in old else new_file}")
+    return status
+
+
+def main():
+    "Parse the command line arguments, and run or compare the benchmarks."
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument(
+        "-o", "--output", help="write the results as JSON to this file"
+    )
+    parser.add_argument(
+        "-k",
+        "--filter",
+        default="",
+        help="only run the benchmarks whose name matches this regex",
+    )
+    parser.add_argument(
+        "-g",
+        "--group",
+        choices=("overhead", "engine"),
+        help="only run the benchmarks in this group",
+    )
+    parser.add_argument(
+        "-r",
+        "--repeat",
+        type=int,
+        default=0,
+        help="the number of timings per benchmark",
+    )
+    parser.add_argument(
+        "--compare",
+        nargs=2,
+        metavar=("OLD", "NEW"),
+        help="compare two results files instead of running the benchmarks",
+    )
+    parser.add_argument(
+        "--threshold",
+        type=float,
+        default=0.1,
+        help="the proportion by which a benchmark can slow down in --compare",
+    )
+    args = parser.parse_args()
+
+    if args.compare:
+        return compare(*args.compare, args.threshold)
+
+    ReportGuard(False)
+    results = []
+    for bench in BENCHMARKS:
+        if not re.search(args.filter, bench["name"]) or (
+            args.group and bench["group"] != args.group
+        ):
+            continue
+        result = run_benchmark(bench, args.repeat)
+        print(
+            f"{result['group']:10} {result['name']:50} "
+            f"{format_time(result['median']):>10}",
+            file=sys.stderr,
+        )
+        results.append(result)
+
+    output = json.dumps({"metadata": metadata(), "results": results}, indent=2)
+    if args.output:
+        with open(args.output, "w", encoding="utf-8") as f:
+            f.write(output + "\n")
+    else:
+        print(output)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -10,43 +10,106 @@
 
 """
 This package provides the user-facing python part of libsemigroups_pybind11
+
+Apart from the constants, and a few other small things, the names in this
+package are only imported when they are first used. The extension module
+_libsemigroups_pybind11 also binds its subsystems (digraphs, elements,
+froidure_pin, and congruences) when they are first used, so that importing the
+package does not bind every class in libsemigroups_pybind11. Set the
+environment variable LIBSEMIGROUPS_PYBIND11_EAGER to bind every subsystem at
+import instead.
 """
 
 
+from importlib import import_module
+
 from _libsemigroups_pybind11 import (
     NEGATIVE_INFINITY,
-    PBR,
     POSITIVE_INFINITY,
     UNDEFINED,
-    ActionDigraph,
-    Bipartition,
-    BMat8,
-    Congruence,
-    FpSemigroup,
-    Kambites,
-    KnuthBendix,
+    CancellationToken,
     ReportGuard,
-    Sims1,
-    Stephen,
-    ToddCoxeter,
-    Ukkonen,
-    add_cycle,
+    _enabled_elements,
     congruence_kind,
-    follow_path,
-    is_acyclic,
-    number_of_words,
-    silo,
-    sislo,
-    topological_sort,
     tril,
-    wilo,
-    wislo,
 )
 
+from .tools import (
+    ELEMENT_TYPES,
+    compare_version_numbers,
+    libsemigroups_version,
+)
+
+_LAZY_NAMES = {
+    "_libsemigroups_pybind11": (
+        "PBR",
+        "ActionDigraph",
+        "Bipartition",
+        "BMat8",
+        "Congruence",
+        "FpSemigroup",
+        "Kambites",
+        "KnuthBendix",
+        "MinimalRepOrc",
+        "Race",
+        "RepOrc",
+        "Sims1",
+        "Stephen",
+        "ToddCoxeter",
+        "Ukkonen",
+        "Word",
+        "add_cycle",
+        "follow_path",
+        "is_acyclic",
+        "number_of_words",
+        "silo",
+        "silo_chunks",
+        "sislo",
+        "sislo_chunks",
+        "topological_sort",
+        "wilo",
+        "wilo_chunks",
+        "wilo_split",
+        "wislo",
+        "wislo_chunks",
+        "wislo_split",
+    ),
+    ".froidure_pin": ("FroidurePin",),
+    ".konieczny": ("Konieczny",),
+    ".matrix": ("Matrix", "MatrixKind", "make_identity"),
+    ".presentation": ("Presentation", "redundant_rule"),
+    ".transf": ("PPerm", "Transf"),
+}
+
+_LAZY = {
+    name: module
+    for module, names in _LAZY_NAMES.items()
+    for name in names
+    if name not in ELEMENT_TYPES or name in _enabled_elements
+}
+
+__all__ = [
+    "NEGATIVE_INFINITY",
+    "POSITIVE_INFINITY",
+    "UNDEFINED",
+    "CancellationToken",
+    "ReportGuard",
+    "compare_version_numbers",
+    "congruence_kind",
+    "libsemigroups_version",
+    "tril",
+] + list(_LAZY)
+
+
+def __getattr__(name):
+    "Import the object called name when it is first used."
+    if name not in _LAZY:
+        raise AttributeError(f"module {__name__!r} has no attribute {name!r}")
+    value = getattr(import_module(_LAZY[name], __name__), name)
+    globals()[name] = value
+    return value
+
 
-from .froidure_pin import FroidurePin
-from .konieczny import Konieczny
-from .matrix import Matrix, MatrixKind, make_identity
-from .presentation import Presentation, redundant_rule
-from .tools import compare_version_numbers, libsemigroups_version
-from .transf import PPerm, Transf
+def __dir__():
+    "Returns the names in this package, including those not yet imported."
+    return sorted(set(globals()) | set(_LAZY))
@@ -13,110 +13,19 @@ This package provides the user-facing python part of libsemigroups_pybind11 for
 FroidurePin.
 """
 
-from _libsemigroups_pybind11 import (
-    Transf16,
-    Transf1,
-    Transf2,
-    Transf4,
-    FroidurePinTransf16,
-    FroidurePinTransf1,
-    FroidurePinTransf2,
-    FroidurePinTransf4,
-    PPerm16,
-    PPerm1,
-    PPerm2,
-    PPerm4,
-    FroidurePinPPerm16,
-    FroidurePinPPerm1,
-    FroidurePinPPerm2,
-    FroidurePinPPerm4,
-    Perm16,
-    Perm1,
-    Perm2,
-    Perm4,
-    FroidurePinPerm16,
-    FroidurePinPerm1,
-    FroidurePinPerm2,
-    FroidurePinPerm4,
-    FroidurePinTCE,
-    FroidurePinKBE,
-    Bipartition,
-    FroidurePinBipartition,
-    PBR,
-    FroidurePinPBR,
-    BMat8,
-    FroidurePinBMat8,
-    BMat,
-    FroidurePinBMat,
-    IntMat,
-    FroidurePinIntMat,
-    MaxPlusMat,
-    FroidurePinMaxPlusMat,
-    MinPlusMat,
-    FroidurePinMinPlusMat,
-    ProjMaxPlusMat,
-    FroidurePinProjMaxPlusMat,
-    MaxPlusTruncMat,
-    FroidurePinMaxPlusTruncMat,
-    MinPlusTruncMat,
-    FroidurePinMinPlusTruncMat,
-    NTPMat,
-    FroidurePinNTPMat,
-)
+import _libsemigroups_pybind11
+from _libsemigroups_pybind11 import FroidurePinKBE, FroidurePinTCE
+
+from .tools import element_types
 
 _ElementToFroidurePin = {
-    Transf16: FroidurePinTransf16,
-    Transf1: FroidurePinTransf1,
-    Transf2: FroidurePinTransf2,
-    Transf4: FroidurePinTransf4,
-    PPerm16: FroidurePinPPerm16,
-    PPerm1: FroidurePinPPerm1,
-    PPerm2: FroidurePinPPerm2,
-    PPerm4: FroidurePinPPerm4,
-    Perm16: FroidurePinPerm16,
-    Perm1: FroidurePinPerm1,
-    Perm2: FroidurePinPerm2,
-    Perm4: FroidurePinPerm4,
-    Bipartition: FroidurePinBipartition,
-    PBR: FroidurePinPBR,
-    BMat8: FroidurePinBMat8,
-    BMat: FroidurePinBMat,
-    IntMat: FroidurePinIntMat,
-    MaxPlusMat: FroidurePinMaxPlusMat,
-    MinPlusMat: FroidurePinMinPlusMat,
-    ProjMaxPlusMat: FroidurePinProjMaxPlusMat,
-    MaxPlusTruncMat: FroidurePinMaxPlusTruncMat,
-    MinPlusTruncMat: FroidurePinMinPlusTruncMat,
-    NTPMat: FroidurePinNTPMat,
+    type_: getattr(_libsemigroups_pybind11, "FroidurePin" + name)
+    for name, type_ in element_types().items()
 }
 
-_FroidurePinTypes = {
-    FroidurePinTransf16: True,
-    FroidurePinTransf1: True,
-    FroidurePinTransf2: True,
-    FroidurePinTransf4: True,
-    FroidurePinPPerm16: True,
-    FroidurePinPPerm1: True,
-    FroidurePinPPerm2: True,
-    FroidurePinPPerm4: True,
-    FroidurePinPerm16: True,
-    FroidurePinPerm1: True,
-    FroidurePinPerm2: True,
-    FroidurePinPerm4: True,
-    FroidurePinBipartition: True,
-    FroidurePinPBR: True,
-    FroidurePinBMat8: True,
-    FroidurePinBMat: True,
-    FroidurePinIntMat: True,
-    FroidurePinMaxPlusMat: True,
-    FroidurePinMinPlusMat: True,
-    FroidurePinProjMaxPlusMat: True,
-    FroidurePinMaxPlusTruncMat: True,
-    FroidurePinMinPlusTruncMat: True,
-    FroidurePinNTPMat: True,
-    FroidurePinKBE: True,
-    FroidurePinTCE: True,
-}
+_FroidurePinTypes = {type_: True for type_ in _ElementToFroidurePin.values()}
+_FroidurePinTypes[FroidurePinKBE] = True
+_FroidurePinTypes[FroidurePinTCE] = True
 
 
 def FroidurePin(*args):
@@ -13,54 +13,27 @@ This package provides the user-facing python part of libsemigroups_pybind11 for
 Konieczny.
 """
 
-from _libsemigroups_pybind11 import (
-    Transf16,
-    Transf1,
-    Transf2,
-    Transf4,
-    KoniecznyTransf16,
-    KoniecznyTransf1,
-    KoniecznyTransf2,
-    KoniecznyTransf4,
-    BMat,
-    BMat8,
-    KoniecznyBMat8,
-    KoniecznyBMat,
-    PPerm16,
-    PPerm1,
-    PPerm2,
-    PPerm4,
-    KoniecznyPPerm16,
-    KoniecznyPPerm1,
-    KoniecznyPPerm2,
-    KoniecznyPPerm4,
-)
+import _libsemigroups_pybind11
+
+from .tools import element_types
 
 _ElementToKonieczny = {
-    Transf16: KoniecznyTransf16,
-    Transf1: KoniecznyTransf1,
-    Transf2: KoniecznyTransf2,
-    Transf4: KoniecznyTransf4,
-    PPerm16: KoniecznyPPerm16,
-    PPerm1: KoniecznyPPerm1,
-    PPerm2: KoniecznyPPerm2,
-    PPerm4: KoniecznyPPerm4,
-    BMat8: KoniecznyBMat8,
-    BMat: KoniecznyBMat,
+    type_: getattr(_libsemigroups_pybind11, "Konieczny" + name)
+    for name, type_ in element_types(
+        "Transf16",
+        "Transf1",
+        "Transf2",
+        "Transf4",
+        "PPerm16",
+        "PPerm1",
+        "PPerm2",
+        "PPerm4",
+        "BMat8",
+        "BMat",
+    ).items()
 }
 
-_KoniecznyTypes = {
-    KoniecznyTransf16: True,
-    KoniecznyTransf1: True,
-    KoniecznyTransf2: True,
-    KoniecznyTransf4: True,
-    KoniecznyPPerm16: True,
-    KoniecznyPPerm1: True,
-    KoniecznyPPerm2: True,
-    KoniecznyPPerm4: True,
-    KoniecznyBMat8: True,
-    KoniecznyBMat: True,
-}
+_KoniecznyTypes = {type_: True for type_ in _ElementToKonieczny.values()}
 
 
 def Konieczny(*args):
@@ -15,16 +15,9 @@ relating to matrices.
 
 from enum import Enum
 
-from _libsemigroups_pybind11 import (
-    BMat,
-    IntMat,
-    MaxPlusMat,
-    MinPlusMat,
-    ProjMaxPlusMat,
-    MaxPlusTruncMat,
-    MinPlusTruncMat,
-    NTPMat,
-)
+import _libsemigroups_pybind11
+
+from .tools import element_types
 
 
 class MatrixKind(Enum):
@@ -43,17 +36,41 @@ class MatrixKind(Enum):
     NTP = 7
 
 
+_MatrixNames = {
+    MatrixKind.Boolean: "BMat",
+    MatrixKind.Integer: "IntMat",
+    MatrixKind.MaxPlus: "MaxPlusMat",
+    MatrixKind.MinPlus: "MinPlusMat",
+    MatrixKind.ProjMaxPlus: "ProjMaxPlusMat",
+    MatrixKind.MaxPlusTrunc: "MaxPlusTruncMat",
+    MatrixKind.MinPlusTrunc: "MinPlusTruncMat",
+    MatrixKind.NTP: "NTPMat",
+}
+
+_Types = element_types(*_MatrixNames.values())
+
 _Matrix = {
-    MatrixKind.Boolean: BMat,
-    MatrixKind.Integer: IntMat,
-    MatrixKind.MaxPlus: MaxPlusMat,
-    MatrixKind.MinPlus: MinPlusMat,
-    MatrixKind.ProjMaxPlus: ProjMaxPlusMat,
-    MatrixKind.MaxPlusTrunc: MaxPlusTruncMat,
-    MatrixKind.MinPlusTrunc: MinPlusTruncMat,
-    MatrixKind.NTP: NTPMat,
+    kind: _Types[name] for kind, name in _MatrixNames.items() if name in _Types
 }
 
+_SemiringNames = {
+    MatrixKind.MaxPlusTrunc: "MaxPlusTruncSemiring",
+    MatrixKind.MinPlusTrunc: "MinPlusTruncSemiring",
+    MatrixKind.NTP: "NTPSemiring",
+}
+
+_Semiring = {
+    kind: getattr(_libsemigroups_pybind11, name)
+    for kind, name in _SemiringNames.items()
+    if kind in _Matrix
+}
+
+
+def _matrix_type(kind):
+    if kind not in _Matrix:
+        raise ValueError(f"the matrix kind {kind} is not enabled in this build")
+    return _Matrix[kind]
+
 
 def _convert_matrix_args(*args):
     if not (len(args) == 1 and isinstance(*args, list)):
@@ -71,18 +88,44 @@ def Matrix(kind: MatrixKind, *args):
     """
     if not isinstance(kind, MatrixKind):
         raise TypeError("the 1st argument must be a MatrixKind")
-    return _Matrix[kind](*_convert_matrix_args(*args))
+    return _matrix_type(kind)(*_convert_matrix_args(*args))
 
 
 def make_identity(kind: MatrixKind, *args) -> Matrix:
     """
     Construct the identity matrix of the appropriate type.
     """
-    return _Matrix[kind].make_identity(*_convert_matrix_args(*args))
+    return _matrix_type(kind).make_identity(*_convert_matrix_args(*args))
 
 
 def make(kind: MatrixKind, *args) -> Matrix:
     """
     Construct a matrix of the appropriate type.
     """
-    return _Matrix[kind].make(*_convert_matrix_args(*args))
+    return _matrix_type(kind).make(*_convert_matrix_args(*args))
+
+
+def products(kind: MatrixKind, *args):
+    """
+    Returns the products of many pairs of matrices of the appropriate type.
+    """
+    return _matrix_type(kind).products(*args)
+
+
+def make_many(kind: MatrixKind, *args) -> list:
+    """
+    Construct and validate many matrices of the appropriate type.
+    """
+    return _matrix_type(kind).make_many(*args)
+
+
+def semiring(kind: MatrixKind, *args):
+    """
+    Returns the semiring of the appropriate type with the given parameters.
+    """
+    if kind not in _Semiring:
+        raise TypeError(
+            "the 1st argument must be MatrixKind.MaxPlusTrunc, "
+            "MatrixKind.MinPlusTrunc, or MatrixKind.NTP"
+        )
+    return _Semiring[kind](*args)
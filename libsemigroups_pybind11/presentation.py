@@ -52,6 +52,9 @@ from _libsemigroups_pybind11 import (
     is_strongly_compressible,
     strongly_compress,
     reduce_to_2_generators,
+    read_presentation,
+    simplify,
+    write_presentation,
 )
 
 
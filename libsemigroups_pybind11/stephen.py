@@ -13,6 +13,9 @@ This package provides the user-facing python part of libsemigroups_pybind11 for
 the stephen namespace from libsemigroups.
 """
 
-from _libsemigroups_pybind11 import (accepts, is_left_factor, left_factors,
+from _libsemigroups_pybind11 import (accepts, accepts_many, is_left_factor,
+                                     is_left_factor_many, left_factors,
+                                     left_factors_chunks,
                                      number_of_left_factors,
-                                     number_of_words_accepted, words_accepted)
+                                     number_of_words_accepted, words_accepted,
+                                     words_accepted_chunks)
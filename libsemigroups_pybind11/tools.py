@@ -63,3 +63,50 @@ def compare_version_numbers(supplied, required):
         + required.__name__
         + ")"
     )
+
+
+# The names of the element types that can be selected using the environment
+# variable LIBSEMIGROUPS_PYBIND11_ELEMENTS when building libsemigroups_pybind11
+# (see setup.py and src/elements.hpp).
+ELEMENT_TYPES = (
+    "Transf16",
+    "Transf1",
+    "Transf2",
+    "Transf4",
+    "PPerm16",
+    "PPerm1",
+    "PPerm2",
+    "PPerm4",
+    "Perm16",
+    "Perm1",
+    "Perm2",
+    "Perm4",
+    "Bipartition",
+    "PBR",
+    "BMat8",
+    "BMat",
+    "IntMat",
+    "MaxPlusMat",
+    "MinPlusMat",
+    "ProjMaxPlusMat",
+    "MaxPlusTruncMat",
+    "MinPlusTruncMat",
+    "NTPMat",
+)
+
+
+def element_types(*names):
+    """
+    Returns a dict whose keys are those of the element types in names (or in
+    ELEMENT_TYPES, if names is empty) that are bound in this build of
+    libsemigroups_pybind11, and whose values are the corresponding types.
+    """
+    # pylint: disable=import-outside-toplevel, protected-access
+    import _libsemigroups_pybind11
+
+    enabled = _libsemigroups_pybind11._enabled_elements
+    return {
+        name: getattr(_libsemigroups_pybind11, name)
+        for name in names or ELEMENT_TYPES
+        if name in enabled
+    }
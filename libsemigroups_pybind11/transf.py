@@ -14,22 +14,46 @@ This package provides a the user-facing python part of libsemigroups_pybind11
 relating to transformations.
 """
 from typing import List
-from _libsemigroups_pybind11 import (
-    Transf16,
-    Transf1,
-    Transf2,
-    Transf4,
-    PPerm16,
-    PPerm1,
-    PPerm2,
-    PPerm4,
-    Perm16,
-    Perm1,
-    Perm2,
-    Perm4,
+
+from .tools import element_types
+
+_TYPES = element_types(
+    "Transf16",
+    "Transf1",
+    "Transf2",
+    "Transf4",
+    "PPerm16",
+    "PPerm1",
+    "PPerm2",
+    "PPerm4",
+    "Perm16",
+    "Perm1",
+    "Perm2",
+    "Perm4",
 )
 
 
+def _smallest_type(prefix: str, deg: int):
+    """
+    Returns the suffix and the type of the smallest element type (in this
+    build) whose name starts with prefix, with degree at least deg.
+    """
+    if deg > 2 ** 32:
+        raise ValueError(
+            "the argument (a list) is must have length at most %d, found %d"
+            % (2 ** 32, deg)
+        )
+    for suffix, max_deg in (("16", 16), ("1", 2 ** 8), ("2", 2 ** 16)):
+        if deg <= max_deg and prefix + suffix in _TYPES:
+            return suffix, _TYPES[prefix + suffix]
+    if prefix + "4" not in _TYPES:
+        raise ValueError(
+            "there is no %s type of degree at least %d in this build"
+            % (prefix, deg)
+        )
+    return "4", _TYPES[prefix + "4"]
+
+
 def Transf(images: List[int]):
     """
     Construct the minimum space occupying _libsemigroups_pybind11
@@ -37,19 +61,10 @@ def Transf(images: List[int]):
     """
     if not isinstance(images, list):
         raise TypeError("the argument must be a list")
-    if len(images) <= 16:
+    suffix, type_ = _smallest_type("Transf", len(images))
+    if suffix == "16":
         images += range(len(images), 16)
-        return Transf16.make(images)
-    if len(images) <= 2 ** 8:
-        return Transf1.make(images)
-    if len(images) <= 2 ** 16:
-        return Transf2.make(images)
-    if len(images) <= 2 ** 32:
-        return Transf4.make(images)
-    raise ValueError(
-        "the argument (a list) is must have length at most %d, found %d"
-        % (2 ** 32, len(images))
-    )
+    return type_.make(images)
 
 
 def PPerm(dom: List[int], ran: List[int], deg: int):
@@ -63,18 +78,8 @@ def PPerm(dom: List[int], ran: List[int], deg: int):
         raise TypeError("the 2nd argument must be a list")
     if not isinstance(deg, int):
         raise TypeError("the 3rd argument must be an int")
-    if deg <= 16:
-        return PPerm16.make(dom, ran, 16)
-    if deg <= 2 ** 8:
-        return PPerm1.make(dom, ran, deg)
-    if deg <= 2 ** 16:
-        return PPerm2.make(dom, ran, deg)
-    if deg <= 2 ** 32:
-        return PPerm4.make(dom, ran, deg)
-    raise ValueError(
-        "the argument (a list) is must have length at most %d, found %d"
-        % (2 ** 32, deg)
-    )
+    suffix, type_ = _smallest_type("PPerm", deg)
+    return type_.make(dom, ran, 16 if suffix == "16" else deg)
 
 
 def Perm(images: List[int]):
@@ -84,16 +89,7 @@ def Perm(images: List[int]):
     """
     if not isinstance(images, list):
         raise TypeError("the argument must be a list")
-    if len(images) <= 16:
+    suffix, type_ = _smallest_type("Perm", len(images))
+    if suffix == "16":
         images += range(len(images), 16)
-        return Perm16.make(images)
-    if len(images) <= 2 ** 8:
-        return Perm1.make(images)
-    if len(images) <= 2 ** 16:
-        return Perm2.make(images)
-    if len(images) <= 2 ** 32:
-        return Perm4.make(images)
-    raise ValueError(
-        "the argument (a list) is must have length at most %d, found %d"
-        % (2 ** 32, len(images))
-    )
+    return type_.make(images)
@@ -22,17 +22,29 @@ from _libsemigroups_pybind11 import (
     add_words,
     is_piece_no_checks,
     is_piece,
+    is_piece_many_no_checks,
+    is_piece_many,
     is_subword_no_checks,
     is_subword,
+    is_subword_many_no_checks,
+    is_subword_many,
     is_suffix_no_checks,
     is_suffix,
+    is_suffix_many_no_checks,
+    is_suffix_many,
     maximal_piece_prefix_no_checks,
     maximal_piece_prefix,
+    maximal_piece_prefix_lengths_no_checks,
+    maximal_piece_prefix_lengths,
     maximal_piece_suffix_no_checks,
     maximal_piece_suffix,
+    maximal_piece_suffix_lengths_no_checks,
+    maximal_piece_suffix_lengths,
     number_of_distinct_subwords,
     number_of_pieces_no_checks,
     number_of_pieces,
+    number_of_pieces_many_no_checks,
+    number_of_pieces_many,
     pieces_no_checks,
     pieces,
 )
@@ -24,6 +24,7 @@ __dir__ = os.path.abspath(os.path.dirname(__file__))
 sys.path.insert(0, __dir__ + "/libsemigroups_pybind11")
 
 from tools import (  # pylint: disable=import-error, wrong-import-position
+    ELEMENT_TYPES,
     libsemigroups_version,
     minimum_libsemigroups_version,
     compare_version_numbers,
@@ -177,11 +178,38 @@ if "CONDA_DEFAULT_ENV" in os.environ and "CONDA_ENVS_PATH" in os.environ:
 print("Include directories are:")
 pprint(include_path)
 
+# The environment variable LIBSEMIGROUPS_PYBIND11_ELEMENTS can be set to a
+# comma separated list of the element types (such as "Transf16,BMat8") to bind,
+# along with FroidurePin and Konieczny over these types, to reduce the size of
+# the extension module; see src/elements.hpp. By default every element type is
+# bound.
+define_macros = []
+
+if os.environ.get("LIBSEMIGROUPS_PYBIND11_ELEMENTS"):
+    elements = [
+        x.strip()
+        for x in os.environ["LIBSEMIGROUPS_PYBIND11_ELEMENTS"].split(",")
+        if x.strip()
+    ]
+    unknown = [x for x in elements if x not in ELEMENT_TYPES]
+    if unknown:
+        raise ValueError(
+            f"unknown element types in LIBSEMIGROUPS_PYBIND11_ELEMENTS: "
+            f"{', '.join(unknown)}, expected some of {', '.join(ELEMENT_TYPES)}"
+        )
+    define_macros.append(("LIBSEMIGROUPS_PYBIND11_SELECT_ELEMENTS", None))
+    define_macros.extend(
+        (f"LIBSEMIGROUPS_PYBIND11_ENABLE_{x.upper()}", None) for x in elements
+    )
+    print("Element types are:")
+    pprint(elements)
+
 ext_modules = [
     Pybind11Extension(
         "_libsemigroups_pybind11",
         glob.glob("src/*.cpp"),
         include_dirs=include_path,
+        define_macros=define_macros,
         language="c++",
         libraries=["semigroups"],
         extra_link_args=[LIBRARY_PATH, "-L/usr/local/lib"],
@@ -204,6 +232,7 @@ setup(
     packages=find_packages(),
     setup_requires=["pkgconfig>=1.5.0"],
     install_requires=[
+        "numpy",
         "pybind11>=2.10.1",
         "packaging>=20.4",
         "pkgconfig>=1.5.0",
@@ -25,12 +25,14 @@
 #include <initializer_list>  // for initializer_list
 #include <iosfwd>            // for string
 #include <string>            // for to_string, basic_string
+#include <utility>           // for move
 #include <vector>            // for vector
 
 // libsemigroups....
-#include <libsemigroups/constants.hpp>       // for operator!=, operator==
+#include <libsemigroups/constants.hpp>       // for POSITIVE_INFINITY, ope...
 #include <libsemigroups/digraph-helper.hpp>  // for topological_sort,...
 #include <libsemigroups/digraph.hpp>         // for ActionDigraph
+#include <libsemigroups/exception.hpp>       // for LIBSEMIGROUPS_EXCEPTION
 #include <libsemigroups/int-range.hpp>       // for IntegralRange<>::value_type
 
 // pybind11....
@@ -39,7 +41,10 @@
 #include <pybind11/stl.h>        // for conversion of C++ to py types
 
 // libsemigroups_pybind11....
-#include "main.hpp"  // for init_action_digraph
+#include "main.hpp"         // for init_action_digraph
+#include "numpy.hpp"        // for input_array, readonly_table, to_array, ...
+#include "parallel.hpp"     // for parallel_for
+#include "path-chunks.hpp"  // for bind_path_chunks, make_path_chunks
 
 namespace py = pybind11;
 
@@ -61,6 +66,68 @@ namespace libsemigroups {
       }
       return result;
     }
+
+    // Returns the ActionDigraph whose table of out-neighbours is the
+    // 2-dimensional array table, entries equal to UNDEFINED are skipped. The
+    // table can be a view of any buffer (such as a memory-mapped file, or a
+    // multiprocessing.shared_memory), and is copied into the digraph with
+    // the GIL released.
+    ActionDigraph<size_t> make_from_table(input_array<size_t> const& table) {
+      if (table.ndim() != 2) {
+        LIBSEMIGROUPS_EXCEPTION(
+            "expected a 2-dimensional array, found %d dimension(s)",
+            static_cast<int>(table.ndim()));
+      }
+      size_t const          nr_rows = table.shape(0);
+      size_t const          nr_cols = table.shape(1);
+      size_t const*         data    = table.data();
+      ActionDigraph<size_t> result(nr_rows, nr_cols);
+      py::gil_scoped_release release;
+      for (size_t i = 0; i < nr_rows; ++i) {
+        for (size_t j = 0; j < nr_cols; ++j) {
+          size_t const val = data[i * nr_cols + j];
+          if (val != UNDEFINED) {
+            result.add_edge(i, val, j);
+          }
+        }
+      }
+      return result;
+    }
+
+    // Returns the array, with the same shape as sources, of the numbers of
+    // paths starting at each node in sources (and ending at target, if target
+    // is not UNDEFINED) with length in the range [min, max), computed using
+    // at most max_threads threads. The number of paths from each source is
+    // computed independently. None of the algorithms for doing so (dfs,
+    // matrix, acyclic, trivial, or automatic, which checks acyclicity with
+    // action_digraph_helper::is_acyclic) reads or fills the caches of
+    // strongly connected components and spanning forests in ad, which are
+    // the only mutable data members of an ActionDigraph, and so it is safe to
+    // call them concurrently.
+    py::array_t<uint64_t>
+    number_of_paths_many(ActionDigraph<size_t> const&     ad,
+                         input_array<size_t> const&       sources,
+                         size_t                           target,
+                         size_t                           min,
+                         size_t                           max,
+                         ActionDigraph<size_t>::algorithm lgrthm,
+                         size_t                           max_threads) {
+      py::array_t<uint64_t> result(shape(sources));
+      size_t const*         in  = sources.data();
+      uint64_t*             out = result.mutable_data();
+      py::gil_scoped_release release;
+      parallel_for(
+          sources.size(),
+          max_threads,
+          [&ad, in, out, target, min, max, lgrthm](size_t i) {
+            if (target == UNDEFINED) {
+              out[i] = ad.number_of_paths(in[i], min, max, lgrthm);
+            } else {
+              out[i] = ad.number_of_paths(in[i], target, min, max, lgrthm);
+            }
+          });
+      return result;
+    }
   }  // namespace libsemigroups_pybind11
 
   using node_type = ActionDigraph<size_t>::node_type;
@@ -70,7 +137,29 @@ namespace libsemigroups {
     // ActionDigraph
     ////////////////////////////////////////////////////////////////////////
 
-    py::class_<ActionDigraph<size_t>> ad(m, "ActionDigraph");
+    py::class_<ActionDigraph<size_t>> ad(
+        m, "ActionDigraph", py::buffer_protocol());
+
+    ad.def_buffer([](ActionDigraph<size_t> const& d) {
+      return libsemigroups_pybind11::table_buffer_info(d);
+    });
+
+    using libsemigroups_pybind11::bind_path_chunks;
+    using libsemigroups_pybind11::input_array;
+    using libsemigroups_pybind11::make_path_chunks;
+
+    bind_path_chunks<ActionDigraph<size_t>::const_panilo_iterator>(
+        m, "PaniloChunks");
+    bind_path_chunks<ActionDigraph<size_t>::const_panislo_iterator>(
+        m, "PanisloChunks");
+    bind_path_chunks<ActionDigraph<size_t>::const_pilo_iterator>(
+        m, "PiloChunks");
+    bind_path_chunks<ActionDigraph<size_t>::const_pislo_iterator>(
+        m, "PisloChunks");
+    bind_path_chunks<ActionDigraph<size_t>::const_pstilo_iterator>(
+        m, "PstiloChunks");
+    bind_path_chunks<ActionDigraph<size_t>::const_pstislo_iterator>(
+        m, "PstisloChunks");
 
     py::enum_<algorithm>(ad, "algorithm")
         .value("dfs", algorithm::dfs, R"pbdoc(Use a depth-first-search.)pbdoc")
@@ -110,6 +199,29 @@ namespace libsemigroups {
              R"pbdoc(
                Construct a copy.
              )pbdoc")
+        .def(py::init([](libsemigroups_pybind11::input_array<size_t> const& t) {
+               return libsemigroups_pybind11::make_from_table(t);
+             }),
+             py::arg("table"),
+             R"pbdoc(
+               Construct from a table of out-neighbours.
+
+               The entry in row ``i`` and column ``j`` of ``table`` is the
+               target of the edge with source ``i`` and label ``j``, or
+               :py:obj:`UNDEFINED` if there is no such edge. The table can be
+               any 2-dimensional array-like object, such as the value of
+               :py:meth:`table` for another digraph, or a ``numpy.ndarray``
+               with ``dtype`` ``numpy.uint64`` viewing a memory-mapped file
+               or a ``multiprocessing.shared_memory.SharedMemory``. In the
+               latter cases, the table is copied into the digraph in a single
+               pass, without holding the GIL.
+
+               :Parameters: **table** (numpy.ndarray) the table.
+               :Raises:
+                 **RuntimeError** if ``table`` is not 2-dimensional, or has an
+                 entry which is not :py:obj:`UNDEFINED` and is at least the
+                 number of rows.
+             )pbdoc")
         .def("__repr__",
              [](ActionDigraph<size_t> const& d) {
                std::string result = "<action digraph with ";
@@ -158,6 +270,32 @@ namespace libsemigroups {
                :Parameters: None
                :return: An ``int``.
              )pbdoc")
+        .def(
+            "table",
+            [](ActionDigraph<size_t> const& d) {
+              return libsemigroups_pybind11::readonly_table(d);
+            },
+            R"pbdoc(
+              Returns a read-only view of the table of out-neighbours.
+
+              The returned value is a ``numpy.ndarray`` with shape
+              ``(number_of_nodes(), out_degree())`` whose entry in row ``i``
+              and column ``j`` is :py:meth:`neighbor` ``(i, j)``, or
+              :py:obj:`UNDEFINED` (the largest value of the ``dtype`` of the
+              array) if there is no such edge. No data is copied, and so the
+              view reflects any subsequent calls to :py:meth:`add_edge`. The
+              same view can be obtained using ``numpy.asarray``, since
+              :py:class:`ActionDigraph` supports the buffer protocol.
+
+              While any such view (or any array or buffer derived from it)
+              exists, the functions that might reallocate the table, namely
+              :py:meth:`add_nodes`, :py:meth:`add_to_out_degree`,
+              :py:meth:`reserve`, and :py:func:`add_cycle`, raise an
+              exception.
+
+              :Parameters: None
+              :return: A ``numpy.ndarray``.
+            )pbdoc")
         .def("validate",
              &ActionDigraph<size_t>::validate,
              R"pbdoc(
@@ -183,28 +321,36 @@ namespace libsemigroups {
 
                :return: (None)
              )pbdoc")
-        .def("add_nodes",
-             &ActionDigraph<size_t>::add_nodes,
-             py::arg("nr"),
-             R"pbdoc(
-               Adds ``nr`` nodes to this.
+        .def(
+            "add_nodes",
+            [](ActionDigraph<size_t>& ad, size_t nr) {
+              libsemigroups_pybind11::throw_if_exported(ad);
+              ad.add_nodes(nr);
+            },
+            py::arg("nr"),
+            R"pbdoc(
+              Adds ``nr`` nodes to this.
 
-               :param nr: the number of nodes to add.
-               :type nr: int
+              :param nr: the number of nodes to add.
+              :type nr: int
 
-               :return: (None)
-             )pbdoc")
-        .def("add_to_out_degree",
-             &ActionDigraph<size_t>::add_to_out_degree,
-             py::arg("nr"),
-             R"pbdoc(
-               Adds ``nr`` to the out-degree of this.
+              :return: (None)
+            )pbdoc")
+        .def(
+            "add_to_out_degree",
+            [](ActionDigraph<size_t>& ad, size_t nr) {
+              libsemigroups_pybind11::throw_if_exported(ad);
+              ad.add_to_out_degree(nr);
+            },
+            py::arg("nr"),
+            R"pbdoc(
+              Adds ``nr`` to the out-degree of this.
 
-               :param nr: the number of new out-edges for every node.
-               :type nr: int
+              :param nr: the number of new out-edges for every node.
+              :type nr: int
 
-               :return: (None)
-             )pbdoc")
+              :return: (None)
+            )pbdoc")
         .def("neighbor",
              &ActionDigraph<size_t>::neighbor,
              py::arg("v"),
@@ -221,22 +367,26 @@ namespace libsemigroups {
                :return:
                  An ``int`` or :py:obj:`UNDEFINED`.
              )pbdoc")
-        .def("reserve",
-             &ActionDigraph<size_t>::reserve,
-             py::arg("m"),
-             py::arg("n"),
-             R"pbdoc(
-               Ensures that this has capacity for m nodes each with n
-               out-edges, but does not modify :py:meth:`number_of_nodes` or
-               :py:meth:`out_degree`.
+        .def(
+            "reserve",
+            [](ActionDigraph<size_t>& ad, size_t m, size_t n) {
+              libsemigroups_pybind11::throw_if_exported(ad);
+              ad.reserve(m, n);
+            },
+            py::arg("m"),
+            py::arg("n"),
+            R"pbdoc(
+              Ensures that this has capacity for m nodes each with n
+              out-edges, but does not modify :py:meth:`number_of_nodes` or
+              :py:meth:`out_degree`.
 
-               :param m: the number of nodes
-               :type m: int
-               :param n: the out-degree
-               :type n: int
+              :param m: the number of nodes
+              :type m: int
+              :param n: the out-degree
+              :type n: int
 
-               :return: (None)
-             )pbdoc")
+              :return: (None)
+            )pbdoc")
         .def("unsafe_neighbor",
              &ActionDigraph<size_t>::unsafe_neighbor,
              py::arg("v"),
@@ -323,6 +473,34 @@ namespace libsemigroups {
                :Parameters: None
                :return: An ``int``.
              )pbdoc")
+        .def(
+            "scc_ids",
+            [](ActionDigraph<size_t> const& ad) {
+              std::vector<size_t> result;
+              // Computing the strongly connected components fills a cache in
+              // ad, and so this happens while holding the GIL, after which
+              // scc_id only reads the cache.
+              ad.number_of_scc();
+              {
+                py::gil_scoped_release release;
+                result.reserve(ad.number_of_nodes());
+                for (auto it = ad.cbegin_nodes(); it != ad.cend_nodes(); ++it) {
+                  result.push_back(ad.scc_id(*it));
+                }
+              }
+              return libsemigroups_pybind11::to_array(std::move(result));
+            },
+            R"pbdoc(
+              Returns the id-numbers of the strongly connected components of
+              all of the nodes.
+
+              This is the same as calling :py:meth:`scc_id` for every node,
+              but is much faster when there are many nodes.
+
+              :Parameters: None
+              :return:
+                A ``numpy.ndarray`` whose ``i``-th entry is ``scc_id(i)``.
+            )pbdoc")
         .def("root_of_scc",
              &ActionDigraph<size_t>::root_of_scc,
              py::arg("nd"),
@@ -370,6 +548,7 @@ namespace libsemigroups {
         .def("number_of_paths",
              py::overload_cast<node_type const>(
                  &ActionDigraph<size_t>::number_of_paths, py::const_),
+             py::call_guard<py::gil_scoped_release>(),
              py::arg("source"),
              R"pbdoc(
                Returns the number of paths originating at the given
@@ -410,6 +589,7 @@ namespace libsemigroups {
                                size_t const,
                                algorithm const>(
                  &ActionDigraph<size_t>::number_of_paths, py::const_),
+             py::call_guard<py::gil_scoped_release>(),
              py::arg("source"),
              py::arg("min"),
              py::arg("max"),
@@ -459,6 +639,7 @@ namespace libsemigroups {
                                size_t const,
                                algorithm const>(
                  &ActionDigraph<size_t>::number_of_paths, py::const_),
+             py::call_guard<py::gil_scoped_release>(),
              py::arg("source"),
              py::arg("target"),
              py::arg("min"),
@@ -487,6 +668,7 @@ namespace libsemigroups {
                size_t                       max) {
               return ad.number_of_paths(source, target, min, max);
             },
+            py::call_guard<py::gil_scoped_release>(),
             py::arg("source"),
             py::arg("target"),
             py::arg("min"),
@@ -508,6 +690,7 @@ namespace libsemigroups {
                node_type                    source,
                size_t                       min,
                size_t max) { return ad.number_of_paths(source, min, max); },
+            py::call_guard<py::gil_scoped_release>(),
             py::arg("source"),
             py::arg("min"),
             py::arg("max"),
@@ -527,7 +710,120 @@ namespace libsemigroups {
                 size_t                       min,
                 PositiveInfinity             max) {
                return ad.number_of_paths(source, min, max);
-             })
+             },
+             py::call_guard<py::gil_scoped_release>())
+        .def(
+            "number_of_paths_many",
+            [](ActionDigraph<size_t> const& ad,
+               input_array<size_t> const&   sources,
+               size_t                       min,
+               size_t                       max,
+               algorithm                    lgrthm,
+               size_t                       max_threads) {
+              return libsemigroups_pybind11::number_of_paths_many(
+                  ad, sources, UNDEFINED, min, max, lgrthm, max_threads);
+            },
+            py::arg("sources"),
+            py::arg("min"),
+            py::arg("max"),
+            py::arg("lgrthm")      = algorithm::automatic,
+            py::arg("max_threads") = 1,
+            R"pbdoc(
+              Returns the numbers of paths starting at many nodes (and
+              ending at a given node) with length in a given range.
+
+              This function computes the same values as calling
+              :py:meth:`number_of_paths` with each of the nodes in
+              ``sources``, but the GIL is released while the values are
+              computed, and the source nodes are divided among
+              ``max_threads`` threads.
+
+              :Parameters: - **sources** (array-like of int) the source nodes
+                           - **target** (int) the target node (optional)
+                           - **min** (int) the minimum length of paths to
+                             count
+                           - **max** (Union[int, PositiveInfinity]) the
+                             maximum length of paths to count
+                           - **lgrthm** (:py:obj:`ActionDigraph.algorithm`)
+                             the algorithm to use (defaults to:
+                             :py:obj:`ActionDigraph.algorithm.automatic`)
+                           - **max_threads** (int) the maximum number of
+                             threads to use, ``0`` means the number of threads
+                             supported by the hardware (defaults to: ``1``)
+
+              :Returns:
+                A ``numpy.ndarray`` with dtype ``uint64`` and the same shape
+                as ``sources``, any entry equal to the value of
+                :py:obj:`POSITIVE_INFINITY` is infinite.
+
+              :Raises:
+                ``RuntimeError`` if any of the nodes is out of range, or if
+                ``lgrthm`` cannot be used to compute any of the values.
+
+              .. doctest::
+
+                 >>> from libsemigroups_pybind11 import ActionDigraph
+                 >>> ad = ActionDigraph(3, 2)
+                 >>> ad.add_edge(0, 1, 0)
+                 >>> ad.add_edge(0, 2, 1)
+                 >>> ad.add_edge(1, 2, 0)
+                 >>> ad.number_of_paths_many([0, 1, 2], 0, 3).tolist()
+                 [4, 2, 1]
+                 >>> ad.number_of_paths_many([0, 1, 2], 2, 0, 3).tolist()
+                 [2, 1, 1]
+            )pbdoc")
+        .def(
+            "number_of_paths_many",
+            [](ActionDigraph<size_t> const& ad,
+               input_array<size_t> const&   sources,
+               size_t                       min,
+               PositiveInfinity const&      max,
+               algorithm                    lgrthm,
+               size_t                       max_threads) {
+              return libsemigroups_pybind11::number_of_paths_many(
+                  ad, sources, UNDEFINED, min, max, lgrthm, max_threads);
+            },
+            py::arg("sources"),
+            py::arg("min"),
+            py::arg("max"),
+            py::arg("lgrthm")      = algorithm::automatic,
+            py::arg("max_threads") = 1)
+        .def(
+            "number_of_paths_many",
+            [](ActionDigraph<size_t> const& ad,
+               input_array<size_t> const&   sources,
+               node_type                    target,
+               size_t                       min,
+               size_t                       max,
+               algorithm                    lgrthm,
+               size_t                       max_threads) {
+              return libsemigroups_pybind11::number_of_paths_many(
+                  ad, sources, target, min, max, lgrthm, max_threads);
+            },
+            py::arg("sources"),
+            py::arg("target"),
+            py::arg("min"),
+            py::arg("max"),
+            py::arg("lgrthm")      = algorithm::automatic,
+            py::arg("max_threads") = 1)
+        .def(
+            "number_of_paths_many",
+            [](ActionDigraph<size_t> const& ad,
+               input_array<size_t> const&   sources,
+               node_type                    target,
+               size_t                       min,
+               PositiveInfinity const&      max,
+               algorithm                    lgrthm,
+               size_t                       max_threads) {
+              return libsemigroups_pybind11::number_of_paths_many(
+                  ad, sources, target, min, max, lgrthm, max_threads);
+            },
+            py::arg("sources"),
+            py::arg("target"),
+            py::arg("min"),
+            py::arg("max"),
+            py::arg("lgrthm")      = algorithm::automatic,
+            py::arg("max_threads") = 1)
         .def(
             "nodes_iterator",
             [](ActionDigraph<size_t> const& ad) {
@@ -799,6 +1095,339 @@ namespace libsemigroups {
                return py::make_iterator(
                    ad.cbegin_pstilo(source, target, mn, mx), ad.cend_pstilo());
              })
+        .def(
+            "panilo_chunks",
+            [](ActionDigraph<size_t> const& ad,
+               node_type const&             source,
+               size_t const&                mn,
+               size_t const&                mx,
+               size_t const&                chunk_size) {
+              return make_path_chunks(ad.cbegin_panilo(source, mn, mx),
+                                      ad.cend_panilo(),
+                                      chunk_size);
+            },
+            py::arg("source"),
+            py::arg("min")        = 0,
+            py::arg("max")        = static_cast<size_t>(POSITIVE_INFINITY),
+            py::arg("chunk_size") = 4096,
+            py::keep_alive<0, 1>(),
+            R"pbdoc(
+              Returns an iterator yielding chunks of the edge labels of the
+              paths, and their last nodes, (in lexicographical order) starting
+              at ``source`` with length in the range :math:`[min, max)`.
+
+              Each chunk is a tuple ``(offsets, letters, targets)`` of
+              ``numpy.ndarray`` such that the edge labels of the ``i``-th
+              path in the chunk are ``letters[offsets[i]:offsets[i + 1]]``,
+              and ``targets[i]`` is the last node of that path. This is
+              equivalent to, but much faster than,
+              :py:meth:`panilo_iterator`.
+
+              :Parameters: - **source** (int) the first node.
+                           - **min** (int) the minimum length of a path to
+                             enumerate (defaults to ``0``)
+                           - **max** (Union[int, PositiveInfinity]) the maximum
+                             length of a path to enumerate (defaults to
+                             :py:obj:`POSITIVE_INFINITY`).
+                           - **chunk_size** (int) the maximum number of paths
+                             in a chunk (defaults to ``4096``).
+
+              :Returns: An iterator.
+            )pbdoc")
+        .def("panilo_chunks",
+             [](ActionDigraph<size_t> const& ad,
+                node_type const&             source,
+                size_t const&                mn,
+                PositiveInfinity const&      mx,
+                size_t const&                chunk_size) {
+               return make_path_chunks(ad.cbegin_panilo(source, mn, mx),
+                                       ad.cend_panilo(),
+                                       chunk_size);
+             },
+             py::arg("source"),
+             py::arg("min")        = 0,
+             py::arg("max")        = POSITIVE_INFINITY,
+             py::arg("chunk_size") = 4096,
+             py::keep_alive<0, 1>())
+        .def(
+            "panislo_chunks",
+            [](ActionDigraph<size_t> const& ad,
+               node_type const&             source,
+               size_t const&                mn,
+               size_t const&                mx,
+               size_t const&                chunk_size) {
+              return make_path_chunks(ad.cbegin_panislo(source, mn, mx),
+                                      ad.cend_panislo(),
+                                      chunk_size);
+            },
+            py::arg("source"),
+            py::arg("min")        = 0,
+            py::arg("max")        = static_cast<size_t>(POSITIVE_INFINITY),
+            py::arg("chunk_size") = 4096,
+            py::keep_alive<0, 1>(),
+            R"pbdoc(
+              Returns an iterator yielding chunks of the edge labels of the
+              paths, and their last nodes, (in short-lex order) starting at
+              ``source`` with length in the range :math:`[min, max)`.
+
+              Each chunk is a tuple ``(offsets, letters, targets)`` of
+              ``numpy.ndarray`` such that the edge labels of the ``i``-th
+              path in the chunk are ``letters[offsets[i]:offsets[i + 1]]``,
+              and ``targets[i]`` is the last node of that path. This is
+              equivalent to, but much faster than,
+              :py:meth:`panislo_iterator`.
+
+              :Parameters: - **source** (int) the first node.
+                           - **min** (int) the minimum length of a path to
+                             enumerate (defaults to ``0``)
+                           - **max** (Union[int, PositiveInfinity]) the maximum
+                             length of a path to enumerate (defaults to
+                             :py:obj:`POSITIVE_INFINITY`).
+                           - **chunk_size** (int) the maximum number of paths
+                             in a chunk (defaults to ``4096``).
+
+              :Returns: An iterator.
+            )pbdoc")
+        .def("panislo_chunks",
+             [](ActionDigraph<size_t> const& ad,
+                node_type const&             source,
+                size_t const&                mn,
+                PositiveInfinity const&      mx,
+                size_t const&                chunk_size) {
+               return make_path_chunks(ad.cbegin_panislo(source, mn, mx),
+                                       ad.cend_panislo(),
+                                       chunk_size);
+             },
+             py::arg("source"),
+             py::arg("min")        = 0,
+             py::arg("max")        = POSITIVE_INFINITY,
+             py::arg("chunk_size") = 4096,
+             py::keep_alive<0, 1>())
+        .def(
+            "pilo_chunks",
+            [](ActionDigraph<size_t> const& ad,
+               node_type const&             source,
+               size_t const&                mn,
+               size_t const&                mx,
+               size_t const&                chunk_size) {
+              return make_path_chunks(ad.cbegin_pilo(source, mn, mx),
+                                      ad.cend_pilo(),
+                                      chunk_size);
+            },
+            py::arg("source"),
+            py::arg("min")        = 0,
+            py::arg("max")        = static_cast<size_t>(POSITIVE_INFINITY),
+            py::arg("chunk_size") = 4096,
+            py::keep_alive<0, 1>(),
+            R"pbdoc(
+              Returns an iterator yielding chunks of the edge labels of the
+              paths (in lexicographical order) starting at ``source`` with
+              length in the range :math:`[min, max)`.
+
+              Each chunk is a tuple ``(offsets, letters)`` of
+              ``numpy.ndarray`` such that the edge labels of the ``i``-th
+              path in the chunk are ``letters[offsets[i]:offsets[i + 1]]``.
+              This is equivalent to, but much faster than,
+              :py:meth:`pilo_iterator`.
+
+              :Parameters: - **source** (int) the first node.
+                           - **min** (int) the minimum length of a path to
+                             enumerate (defaults to ``0``)
+                           - **max** (Union[int, PositiveInfinity]) the maximum
+                             length of a path to enumerate (defaults to
+                             :py:obj:`POSITIVE_INFINITY`).
+                           - **chunk_size** (int) the maximum number of paths
+                             in a chunk (defaults to ``4096``).
+
+              :Returns: An iterator.
+            )pbdoc")
+        .def("pilo_chunks",
+             [](ActionDigraph<size_t> const& ad,
+                node_type const&             source,
+                size_t const&                mn,
+                PositiveInfinity const&      mx,
+                size_t const&                chunk_size) {
+               return make_path_chunks(ad.cbegin_pilo(source, mn, mx),
+                                       ad.cend_pilo(),
+                                       chunk_size);
+             },
+             py::arg("source"),
+             py::arg("min")        = 0,
+             py::arg("max")        = POSITIVE_INFINITY,
+             py::arg("chunk_size") = 4096,
+             py::keep_alive<0, 1>())
+        .def(
+            "pislo_chunks",
+            [](ActionDigraph<size_t> const& ad,
+               node_type const&             source,
+               size_t const&                mn,
+               size_t const&                mx,
+               size_t const&                chunk_size) {
+              return make_path_chunks(ad.cbegin_pislo(source, mn, mx),
+                                      ad.cend_pislo(),
+                                      chunk_size);
+            },
+            py::arg("source"),
+            py::arg("min")        = 0,
+            py::arg("max")        = static_cast<size_t>(POSITIVE_INFINITY),
+            py::arg("chunk_size") = 4096,
+            py::keep_alive<0, 1>(),
+            R"pbdoc(
+              Returns an iterator yielding chunks of the edge labels of the
+              paths (in short-lex order) starting at ``source`` with length
+              in the range :math:`[min, max)`.
+
+              Each chunk is a tuple ``(offsets, letters)`` of
+              ``numpy.ndarray`` such that the edge labels of the ``i``-th
+              path in the chunk are ``letters[offsets[i]:offsets[i + 1]]``.
+              This is equivalent to, but much faster than,
+              :py:meth:`pislo_iterator`.
+
+              :Parameters: - **source** (int) the first node.
+                           - **min** (int) the minimum length of a path to
+                             enumerate (defaults to ``0``)
+                           - **max** (Union[int, PositiveInfinity]) the maximum
+                             length of a path to enumerate (defaults to
+                             :py:obj:`POSITIVE_INFINITY`).
+                           - **chunk_size** (int) the maximum number of paths
+                             in a chunk (defaults to ``4096``).
+
+              :Returns: An iterator.
+            )pbdoc")
+        .def("pislo_chunks",
+             [](ActionDigraph<size_t> const& ad,
+                node_type const&             source,
+                size_t const&                mn,
+                PositiveInfinity const&      mx,
+                size_t const&                chunk_size) {
+               return make_path_chunks(ad.cbegin_pislo(source, mn, mx),
+                                       ad.cend_pislo(),
+                                       chunk_size);
+             },
+             py::arg("source"),
+             py::arg("min")        = 0,
+             py::arg("max")        = POSITIVE_INFINITY,
+             py::arg("chunk_size") = 4096,
+             py::keep_alive<0, 1>())
+        .def(
+            "pstilo_chunks",
+            [](ActionDigraph<size_t> const& ad,
+               node_type const&             source,
+               node_type const&             target,
+               size_t const&                mn,
+               size_t const&                mx,
+               size_t const&                chunk_size) {
+              return make_path_chunks(ad.cbegin_pstilo(source, target, mn, mx),
+                                      ad.cend_pstilo(),
+                                      chunk_size);
+            },
+            py::arg("source"),
+            py::arg("target"),
+            py::arg("min")        = 0,
+            py::arg("max")        = static_cast<size_t>(POSITIVE_INFINITY),
+            py::arg("chunk_size") = 4096,
+            py::keep_alive<0, 1>(),
+            R"pbdoc(
+              Returns an iterator yielding chunks of the edge labels of the
+              paths (in lex order) starting at the node ``source`` and
+              ending at the node ``target`` with length in the range
+              :math:`[min, max)`.
+
+              Each chunk is a tuple ``(offsets, letters)`` of
+              ``numpy.ndarray`` such that the edge labels of the ``i``-th
+              path in the chunk are ``letters[offsets[i]:offsets[i + 1]]``.
+              This is equivalent to, but much faster than,
+              :py:meth:`pstilo_iterator`.
+
+              :Parameters: - **source** (int) the first node.
+                           - **target** (int) the last node.
+                           - **min** (int) the minimum length of a path to
+                             enumerate (defaults to ``0``)
+                           - **max** (Union[int, PositiveInfinity]) the maximum
+                             length of a path to enumerate (defaults to
+                             :py:obj:`POSITIVE_INFINITY`).
+                           - **chunk_size** (int) the maximum number of paths
+                             in a chunk (defaults to ``4096``).
+
+              :Returns: An iterator.
+            )pbdoc")
+        .def("pstilo_chunks",
+             [](ActionDigraph<size_t> const& ad,
+                node_type const&             source,
+                node_type const&             target,
+                size_t const&                mn,
+                PositiveInfinity const&      mx,
+                size_t const&                chunk_size) {
+               return make_path_chunks(ad.cbegin_pstilo(source, target, mn, mx),
+                                       ad.cend_pstilo(),
+                                       chunk_size);
+             },
+             py::arg("source"),
+             py::arg("target"),
+             py::arg("min")        = 0,
+             py::arg("max")        = POSITIVE_INFINITY,
+             py::arg("chunk_size") = 4096,
+             py::keep_alive<0, 1>())
+        .def(
+            "pstislo_chunks",
+            [](ActionDigraph<size_t> const& ad,
+               node_type const&             source,
+               node_type const&             target,
+               size_t const&                mn,
+               size_t const&                mx,
+               size_t const&                chunk_size) {
+              return make_path_chunks(ad.cbegin_pstislo(source, target, mn, mx),
+                                      ad.cend_pstislo(),
+                                      chunk_size);
+            },
+            py::arg("source"),
+            py::arg("target"),
+            py::arg("min")        = 0,
+            py::arg("max")        = static_cast<size_t>(POSITIVE_INFINITY),
+            py::arg("chunk_size") = 4096,
+            py::keep_alive<0, 1>(),
+            R"pbdoc(
+              Returns an iterator yielding chunks of the edge labels of the
+              paths (in short-lex order) starting at the node ``source`` and
+              ending at the node ``target`` with length in the range
+              :math:`[min, max)`.
+
+              Each chunk is a tuple ``(offsets, letters)`` of
+              ``numpy.ndarray`` such that the edge labels of the ``i``-th
+              path in the chunk are ``letters[offsets[i]:offsets[i + 1]]``.
+              This is equivalent to, but much faster than,
+              :py:meth:`pstislo_iterator`.
+
+              :Parameters: - **source** (int) the first node.
+                           - **target** (int) the last node.
+                           - **min** (int) the minimum length of a path to
+                             enumerate (defaults to ``0``)
+                           - **max** (Union[int, PositiveInfinity]) the maximum
+                             length of a path to enumerate (defaults to
+                             :py:obj:`POSITIVE_INFINITY`).
+                           - **chunk_size** (int) the maximum number of paths
+                             in a chunk (defaults to ``4096``).
+
+              :Returns: An iterator.
+            )pbdoc")
+        .def("pstislo_chunks",
+             [](ActionDigraph<size_t> const& ad,
+                node_type const&             source,
+                node_type const&             target,
+                size_t const&                mn,
+                PositiveInfinity const&      mx,
+                size_t const&                chunk_size) {
+               return make_path_chunks(
+                   ad.cbegin_pstislo(source, target, mn, mx),
+                   ad.cend_pstislo(),
+                   chunk_size);
+             },
+             py::arg("source"),
+             py::arg("target"),
+             py::arg("min")        = 0,
+             py::arg("max")        = POSITIVE_INFINITY,
+             py::arg("chunk_size") = 4096,
+             py::keep_alive<0, 1>())
         .def_static(
             "random",
             [](size_t nr_nodes, size_t out_degree) {
@@ -846,8 +1475,10 @@ namespace libsemigroups {
     // that can be included here!
 
     m.def("add_cycle",
-          py::overload_cast<ActionDigraph<size_t>&, size_t>(
-              &action_digraph_helper::add_cycle<size_t>),
+          [](ActionDigraph<size_t>& ad, size_t N) {
+            libsemigroups_pybind11::throw_if_exported(ad);
+            action_digraph_helper::add_cycle(ad, N);
+          },
           py::arg("ad"),
           py::arg("N"),
           R"pbdoc(
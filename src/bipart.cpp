@@ -33,13 +33,15 @@
 #include <pybind11/stl.h>
 
 // libsemigroups_pybind11....
-#include "main.hpp"  // for init_bipart
+#include "elements.hpp"  // for LIBSEMIGROUPS_PYBIND11_ENABLE_BIPARTITION
+#include "main.hpp"      // for init_bipart
 
 namespace py = pybind11;
 
 namespace libsemigroups {
   // TODO(later) implement Blocks and uncomment the def's below.
 
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_BIPARTITION
   void init_bipart(py::module& m) {
     py::class_<Bipartition>(m,
                             "Bipartition",
@@ -50,6 +52,18 @@ namespace libsemigroups {
    for more details.
                             )pbdoc")
         .def(py::init<Bipartition const&>())
+        .def(py::pickle(
+            [](Bipartition const& x) {
+              std::vector<uint32_t> lookup;
+              for (size_t i = 0; i < 2 * x.degree(); ++i) {
+                lookup.push_back(x.at(i));
+              }
+              return py::make_tuple(lookup);
+            },
+            [](py::tuple state) {
+              return Bipartition::make(
+                  state[0].cast<std::vector<uint32_t>>());
+            }))
         .def_static("make_identity",
                     py::overload_cast<size_t>(&Bipartition::identity),
                     py::arg("n"),
@@ -246,4 +260,5 @@ namespace libsemigroups {
               :return: An iterator.
             )pbdoc");
   }
+#endif
 }  // namespace libsemigroups
@@ -29,16 +29,20 @@
 #include <libsemigroups/string.hpp>  // for to_string
 
 // pybind11....
+#include <pybind11/numpy.h>      // for array_t
 #include <pybind11/operators.h>  // for self, operator*, self_t
 #include <pybind11/pybind11.h>   // for class_, init, module
 #include <pybind11/stl.h>
 
 // libsemigroups_pybind11....
-#include "main.hpp"  // for init_bmat8
+#include "elements.hpp"  // for LIBSEMIGROUPS_PYBIND11_ENABLE_BMAT8
+#include "main.hpp"      // for init_bmat8
+#include "numpy.hpp"     // for input_array, batch_products
 
 namespace py = pybind11;
 
 namespace libsemigroups {
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_BMAT8
   void init_bmat8(py::module& m) {
     py::class_<BMat8>(m, "BMat8")
         .def(py::init<>(), R"pbdoc(
@@ -47,6 +51,9 @@ namespace libsemigroups {
         .def(py::init<uint64_t>())
         .def(py::init<BMat8 const&>())
         .def(py::init<std::vector<std::vector<bool>> const&>())
+        .def(py::pickle(
+            [](BMat8 const& x) { return py::make_tuple(x.to_int()); },
+            [](py::tuple state) { return BMat8(state[0].cast<uint64_t>()); }))
         .def("__eq__", &BMat8::operator==)
         .def("__lt__", &BMat8::operator<)  // NOLINT(whitespace/operators)
         .def("get",
@@ -129,6 +136,49 @@ namespace libsemigroups {
               )pbdoc")
 
         .def(py::self * py::self)
+        .def_static(
+            "products",
+            [](libsemigroups_pybind11::input_array<uint64_t> const& a,
+               libsemigroups_pybind11::input_array<uint64_t> const& b) {
+              return libsemigroups_pybind11::batch_products<uint64_t>(
+                  a,
+                  b,
+                  0,
+                  [](uint64_t const* first) { return BMat8(*first); },
+                  [](BMat8& z, BMat8 const& x, BMat8 const& y) { z = x * y; },
+                  [](BMat8 const& z, uint64_t* first) {
+                    *first = z.to_int();
+                  });
+            },
+            py::arg("a"),
+            py::arg("b"),
+            R"pbdoc(
+              Returns the products of many pairs of ``BMat8``.
+
+              The arguments are arrays of the integer representations of
+              ``BMat8`` (see :py:meth:`to_int`) with the same shape, or one of
+              them is a single integer, which is multiplied by every entry of
+              the other. The product is computed for each pair of
+              corresponding entries, with the GIL released.
+
+              :param a: the left hand sides.
+              :type a: numpy.ndarray
+              :param b: the right hand sides.
+              :type b: numpy.ndarray
+
+              :return:
+                A ``numpy.ndarray`` of the integer representations of the
+                products.
+
+              .. doctest::
+
+                 >>> from libsemigroups_pybind11 import BMat8
+                 >>> x = BMat8([[0, 1], [1, 0]])
+                 >>> y = BMat8([[1, 1], [0, 1]])
+                 >>> z = BMat8.products([x.to_int(), y.to_int()], y.to_int())
+                 >>> z.tolist() == [(x * y).to_int(), (y * y).to_int()]
+                 True
+            )pbdoc")
         .def_static("random", py::overload_cast<>(&BMat8::random))
         .def_static("random", py::overload_cast<size_t>(&BMat8::random))
         .def("swap",
@@ -320,4 +370,5 @@ namespace libsemigroups {
                   2
              )pbdoc");
   }
+#endif
 }  // namespace libsemigroups
@@ -0,0 +1,63 @@
+//
+// libsemigroups_pybind11
+// Copyright (C) 2023 James D. Mitchell
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+// This file contains the class CancellationToken, which can be used to stop
+// any number of Runners (running in any number of threads) at once, without
+// acquiring the GIL. A Runner checks a token by running with the token as its
+// run_until predicate (see run_until_cancelled in runner.hpp), and so the
+// check is just a (relaxed) atomic load every time the Runner checks whether
+// it should stop.
+
+#ifndef SRC_CANCELLATION_HPP_
+#define SRC_CANCELLATION_HPP_
+
+// C++ stl headers....
+#include <atomic>  // for atomic, memory_order_relaxed
+#include <memory>  // for shared_ptr, make_shared
+
+namespace libsemigroups {
+  namespace libsemigroups_pybind11 {
+
+    class CancellationToken {
+     public:
+      CancellationToken() : _flag(std::make_shared<std::atomic<bool>>(false)) {}
+
+      // Copies share the same flag, so that the copy of a token held by a
+      // running predicate is cancelled with the original.
+      CancellationToken(CancellationToken const&)            = default;
+      CancellationToken& operator=(CancellationToken const&) = default;
+
+      void cancel() noexcept {
+        _flag->store(true, std::memory_order_relaxed);
+      }
+
+      void reset() noexcept {
+        _flag->store(false, std::memory_order_relaxed);
+      }
+
+      bool cancelled() const noexcept {
+        return _flag->load(std::memory_order_relaxed);
+      }
+
+     private:
+      std::shared_ptr<std::atomic<bool>> _flag;
+    };
+  }  // namespace libsemigroups_pybind11
+}  // namespace libsemigroups
+
+#endif  // SRC_CANCELLATION_HPP_
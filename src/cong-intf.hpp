@@ -0,0 +1,220 @@
+//
+// libsemigroups_pybind11
+// Copyright (C) 2023 James D. Mitchell
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+// This file contains helpers shared by the bindings of the classes derived
+// from libsemigroups::CongruenceInterface, for the batch functions
+// word_to_class_indices and contains_many. Each of these first calls
+// prepare(x), with the GIL released, which must run x to completion, and
+// leave x in a state where word_to_class_index does not modify x, so that it
+// can be called from several threads at once.
+
+#ifndef SRC_CONG_INTF_HPP_
+#define SRC_CONG_INTF_HPP_
+
+// C std headers....
+#include <stddef.h>  // for size_t
+
+// C++ stl headers....
+#include <vector>  // for vector
+
+// libsemigroups....
+#include <libsemigroups/exception.hpp>  // for LIBSEMIGROUPS_EXCEPTION
+#include <libsemigroups/types.hpp>      // for word_type
+
+// pybind11....
+#include <pybind11/numpy.h>     // for array_t
+#include <pybind11/pybind11.h>  // for class_, arg, gil_scoped_release
+
+// libsemigroups_pybind11....
+#include "doc-strings.hpp"  // for word_to_class_indices, ...
+#include "numpy.hpp"        // for unflatten_words
+#include "parallel.hpp"     // for parallel_for
+
+namespace libsemigroups {
+  namespace py = pybind11;
+
+  namespace libsemigroups_pybind11 {
+
+    // Returns the array of the class indices of the words in words, computed
+    // using at most max_threads threads.
+    template <typename T, typename F>
+    py::array_t<size_t>
+    word_to_class_indices(T&                            x,
+                          std::vector<word_type> const& words,
+                          size_t                        max_threads,
+                          F&&                           prepare) {
+      py::array_t<size_t> result(words.size());
+      size_t*             out = result.mutable_data();
+      {
+        py::gil_scoped_release release;
+        prepare(x);
+        parallel_for(words.size(), max_threads, [&x, &words, out](size_t i) {
+          out[i] = x.word_to_class_index(words[i]);
+        });
+      }
+      return result;
+    }
+
+    // Returns the array whose i-th entry is true if and only if us[i] and
+    // vs[i] belong to the same class, computed using at most max_threads
+    // threads.
+    template <typename T, typename F>
+    py::array_t<bool> contains_many(T&                            x,
+                                    std::vector<word_type> const& us,
+                                    std::vector<word_type> const& vs,
+                                    size_t                        max_threads,
+                                    F&&                           prepare) {
+      if (us.size() != vs.size()) {
+        LIBSEMIGROUPS_EXCEPTION("the arguments must have the same length, "
+                                "found %llu and %llu",
+                                static_cast<unsigned long long>(us.size()),
+                                static_cast<unsigned long long>(vs.size()));
+      }
+      py::array_t<bool> result(us.size());
+      bool*             out = result.mutable_data();
+      {
+        py::gil_scoped_release release;
+        prepare(x);
+        parallel_for(us.size(), max_threads, [&x, &us, &vs, out](size_t i) {
+          out[i] = (x.word_to_class_index(us[i])
+                    == x.word_to_class_index(vs[i]));
+        });
+      }
+      return result;
+    }
+
+    // Adds the overloads of word_to_class_indices and contains_many, for
+    // words given as lists and in the flat format (see unflatten_words), to
+    // the class x. If parallel is false, then the argument max_threads is not
+    // defined, and a single thread is used.
+    template <typename T, typename... Extra, typename F>
+    void bind_cong_intf_batch(py::class_<T, Extra...>& x,
+                              F                         prepare,
+                              bool                      parallel) {
+      if (parallel) {
+        x.def(
+             "word_to_class_indices",
+             [prepare](T&                            self,
+                       std::vector<word_type> const& words,
+                       size_t                        max_threads) {
+               return word_to_class_indices(self, words, max_threads, prepare);
+             },
+             py::arg("words"),
+             py::arg("max_threads") = 1,
+             cong_intf_doc_strings::word_to_class_indices)
+            .def(
+                "word_to_class_indices",
+                [prepare](T&                self,
+                          py::object const& offsets,
+                          py::object const& letters,
+                          size_t            max_threads) {
+                  return word_to_class_indices(
+                      self,
+                      unflatten_words(offsets, letters),
+                      max_threads,
+                      prepare);
+                },
+                py::arg("offsets"),
+                py::arg("letters"),
+                py::arg("max_threads") = 1,
+                cong_intf_doc_strings::word_to_class_indices_flat)
+            .def(
+                "contains_many",
+                [prepare](T&                            self,
+                          std::vector<word_type> const& us,
+                          std::vector<word_type> const& vs,
+                          size_t                        max_threads) {
+                  return contains_many(self, us, vs, max_threads, prepare);
+                },
+                py::arg("us"),
+                py::arg("vs"),
+                py::arg("max_threads") = 1,
+                cong_intf_doc_strings::contains_many)
+            .def(
+                "contains_many",
+                [prepare](T&                self,
+                          py::object const& u_offsets,
+                          py::object const& u_letters,
+                          py::object const& v_offsets,
+                          py::object const& v_letters,
+                          size_t            max_threads) {
+                  return contains_many(self,
+                                       unflatten_words(u_offsets, u_letters),
+                                       unflatten_words(v_offsets, v_letters),
+                                       max_threads,
+                                       prepare);
+                },
+                py::arg("u_offsets"),
+                py::arg("u_letters"),
+                py::arg("v_offsets"),
+                py::arg("v_letters"),
+                py::arg("max_threads") = 1,
+                cong_intf_doc_strings::contains_many_flat);
+      } else {
+        x.def(
+             "word_to_class_indices",
+             [prepare](T& self, std::vector<word_type> const& words) {
+               return word_to_class_indices(self, words, 1, prepare);
+             },
+             py::arg("words"),
+             cong_intf_doc_strings::word_to_class_indices)
+            .def(
+                "word_to_class_indices",
+                [prepare](T&                self,
+                          py::object const& offsets,
+                          py::object const& letters) {
+                  return word_to_class_indices(
+                      self, unflatten_words(offsets, letters), 1, prepare);
+                },
+                py::arg("offsets"),
+                py::arg("letters"),
+                cong_intf_doc_strings::word_to_class_indices_flat)
+            .def(
+                "contains_many",
+                [prepare](T&                            self,
+                          std::vector<word_type> const& us,
+                          std::vector<word_type> const& vs) {
+                  return contains_many(self, us, vs, 1, prepare);
+                },
+                py::arg("us"),
+                py::arg("vs"),
+                cong_intf_doc_strings::contains_many)
+            .def(
+                "contains_many",
+                [prepare](T&                self,
+                          py::object const& u_offsets,
+                          py::object const& u_letters,
+                          py::object const& v_offsets,
+                          py::object const& v_letters) {
+                  return contains_many(self,
+                                       unflatten_words(u_offsets, u_letters),
+                                       unflatten_words(v_offsets, v_letters),
+                                       1,
+                                       prepare);
+                },
+                py::arg("u_offsets"),
+                py::arg("u_letters"),
+                py::arg("v_offsets"),
+                py::arg("v_letters"),
+                cong_intf_doc_strings::contains_many_flat);
+      }
+    }
+  }  // namespace libsemigroups_pybind11
+}  // namespace libsemigroups
+
+#endif  // SRC_CONG_INTF_HPP_
@@ -40,8 +40,10 @@
 #include <pybind11/stl.h>
 
 // libsemigroups_pybind11....
+#include "cong-intf.hpp"    // for bind_cong_intf_batch
 #include "doc-strings.hpp"  // for add_pair, class_index_to_word
 #include "main.hpp"         // for init_cong
+#include "runner.hpp"       // for run_until, run_until_cancelled
 
 // Forward decls
 namespace libsemigroups {
@@ -52,8 +54,8 @@ namespace py = pybind11;
 
 namespace libsemigroups {
   void init_cong(py::module& m) {
-    py::class_<Congruence>(m, "Congruence")
-        .def(py::init<congruence_kind>(),
+    py::class_<Congruence> cong(m, "Congruence");
+    cong.def(py::init<congruence_kind>(),
              py::arg("kind"),
              R"pbdoc(
                Construct from kind (left/right/2-sided) and options.
@@ -131,6 +133,7 @@ namespace libsemigroups {
         .def("kill", &Congruence::kill, runner_doc_strings::kill)
         .def("run",
              &Congruence::run,
+             py::call_guard<py::gil_scoped_release>(),
              R"pbdoc(
                Run all the underlying algorithms to determine the structure of
                the congruence.
@@ -141,11 +144,17 @@ namespace libsemigroups {
         .def("run_for",
              (void (Congruence::*)(std::chrono::nanoseconds)) & Runner::run_for,
              py::arg("t"),
+             py::call_guard<py::gil_scoped_release>(),
              runner_doc_strings::run_for)
         .def("run_until",
-             (void (Congruence::*)(std::function<bool()>&)) & Runner::run_until,
+             &libsemigroups_pybind11::run_until<Congruence>,
              py::arg("func"),
+             py::arg("poll") = std::chrono::nanoseconds(0),
              runner_doc_strings::run_until)
+        .def("run_until",
+             &libsemigroups_pybind11::run_until_cancelled<Congruence>,
+             py::arg("token"),
+             runner_doc_strings::run_until_cancelled)
         .def("less",
              &Congruence::less,
              py::arg("u"),
@@ -250,5 +259,11 @@ namespace libsemigroups {
                                        c.cend_generating_pairs());
             },
             cong_intf_doc_strings::generating_pairs);
+
+    // Congruence::word_to_class_index calls the same function of the winner
+    // of its race, which may not be thread-safe (for example, if it is a
+    // KnuthBendix), and so the batch functions use a single thread.
+    libsemigroups_pybind11::bind_cong_intf_batch(
+        cong, [](Congruence& c) { c.run(); }, false);
   }
 }  // namespace libsemigroups
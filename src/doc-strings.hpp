@@ -78,8 +78,57 @@ namespace runner_doc_strings {
                Run until a nullary predicate returns ``True`` or
                :py:meth:`finished`.
 
+               The GIL is released while the algorithm runs, and is only
+               reacquired to call ``func``. Any exception raised by ``func``
+               stops the algorithm and is then re-raised.
+
                :param func: a function.
                :type func: Callable[], bool
+               :param poll:
+                 the minimum time between calls to ``func`` (default: call
+                 ``func`` every time the algorithm checks if it should stop).
+               :type poll: datetime.timedelta
+
+               :return: (None)
+             )pbdoc";
+
+  auto const run_until_cancelled =
+      R"pbdoc(
+               Run until a :py:class:`CancellationToken` is cancelled or
+               :py:meth:`finished`.
+
+               The GIL is released while the algorithm runs, and is not
+               reacquired to check if ``token`` has been cancelled. The same
+               token can be used to stop any number of algorithms, running in
+               any number of threads, at once.
+
+               :param token: the token.
+               :type token: CancellationToken
+
+               :return: (None)
+             )pbdoc";
+
+  auto const run_with_stats =
+      R"pbdoc(
+               Run until :py:meth:`finished`, periodically calling a function
+               with the current values of the counters in :py:meth:`stats`.
+
+               The GIL is released while the algorithm runs, and is only
+               reacquired to call ``func``. The function ``func`` is called
+               with the dictionary returned by :py:meth:`stats`, with the
+               additional key ``"elapsed"`` whose value is the number of
+               seconds since this function was called. The function ``func``
+               is called at most once every ``interval``, and once more when
+               the algorithm stops. If ``func`` returns a true value, then the
+               algorithm is stopped. Any exception raised by ``func`` stops
+               the algorithm and is then re-raised.
+
+               :param func: a function.
+               :type func: Callable[[dict], Optional[bool]]
+               :param interval:
+                 the minimum time between calls to ``func`` (default: 1
+                 second).
+               :type interval: datetime.timedelta
 
                :return: (None)
              )pbdoc";
@@ -87,6 +136,9 @@ namespace runner_doc_strings {
   auto const run =
       R"pbdoc(
                Run the algorithm until it finishes.
+
+               The GIL is released while the algorithm runs.
+
                :Parameters: None
 
                :return: (None)
@@ -384,5 +436,79 @@ namespace cong_intf_doc_strings {
                :Parameters: None
                :return: An iterator.
             )pbdoc";
+
+  auto const word_to_class_indices = R"pbdoc(
+               Returns the indices of the classes of many words.
+
+               This function runs the congruence enumeration to completion,
+               and returns a 1-dimensional ``numpy.ndarray`` whose ``i``-th
+               entry is :py:meth:`word_to_class_index` of ``words[i]``. The
+               words are processed with the GIL released, and, if the
+               argument ``max_threads`` is supported, split between (at
+               most) ``max_threads`` threads.
+
+               :Parameters: - **words** (List[List[int]]) - the words.
+                            - **max_threads** (int) - the maximum number of
+                              threads to use, ``0`` means as many as the
+                              hardware supports (defaults to ``1``).
+
+               :Returns: A ``numpy.ndarray``.
+
+               :Raises:
+                 ``RuntimeError`` if any of the words contains a letter that
+                 is out of bounds.
+               )pbdoc";
+
+  auto const contains_many = R"pbdoc(
+               Check if many pairs of words belong to the same class.
+
+               This function runs the congruence enumeration to completion,
+               and returns a 1-dimensional ``numpy.ndarray`` of ``bool``
+               whose ``i``-th entry is :py:meth:`contains` of ``us[i]`` and
+               ``vs[i]``. The words are processed with the GIL released, and,
+               if the argument ``max_threads`` is supported, split between (at
+               most) ``max_threads`` threads.
+
+               :Parameters: - **us** (List[List[int]]) - the first words.
+                            - **vs** (List[List[int]]) - the second words.
+                            - **max_threads** (int) - the maximum number of
+                              threads to use, ``0`` means as many as the
+                              hardware supports (defaults to ``1``).
+
+               :Returns: A ``numpy.ndarray``.
+
+               :Raises:
+                 ``RuntimeError`` if ``us`` and ``vs`` have different
+                 lengths, or if any of the words contains a letter that is
+                 out of bounds.
+               )pbdoc";
+
+  auto const word_to_class_indices_flat = R"pbdoc(
+               As above, but the words are given in a flat format, where the
+               ``i``-th word is ``letters[offsets[i]:offsets[i + 1]]``.
+
+               :Parameters: - **offsets** (numpy.ndarray) - the offsets of the
+                              words in ``letters``.
+                            - **letters** (numpy.ndarray) - the letters of
+                              the words.
+                            - **max_threads** (int) - as above.
+               )pbdoc";
+
+  auto const contains_many_flat = R"pbdoc(
+               As above, but the words ``us`` and ``vs`` are given in the flat
+               format of :py:meth:`word_to_class_indices`, where ``us[i]`` is
+               ``u_letters[u_offsets[i]:u_offsets[i + 1]]``, and similarly
+               for ``vs``.
+
+               :Parameters: - **u_offsets** (numpy.ndarray) - the offsets of
+                              the first words in ``u_letters``.
+                            - **u_letters** (numpy.ndarray) - the letters of
+                              the first words.
+                            - **v_offsets** (numpy.ndarray) - the offsets of
+                              the second words in ``v_letters``.
+                            - **v_letters** (numpy.ndarray) - the letters of
+                              the second words.
+                            - **max_threads** (int) - as above.
+               )pbdoc";
 }  // namespace cong_intf_doc_strings
 #endif  //  SRC_DOC_STRINGS_HPP_
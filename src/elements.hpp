@@ -0,0 +1,158 @@
+//
+// libsemigroups_pybind11
+// Copyright (C) 2023 James D. Mitchell
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+// This file contains the macros that select which element types are bound.
+// The element type with Python name Name (such as Transf16 or BMat8) is bound,
+// along with FroidurePin and Konieczny over that type, if and only if the
+// macro LIBSEMIGROUPS_PYBIND11_ENABLE_NAME (such as
+// LIBSEMIGROUPS_PYBIND11_ENABLE_TRANSF16) is defined. If the macro
+// LIBSEMIGROUPS_PYBIND11_SELECT_ELEMENTS is not defined, then every element
+// type is bound. These macros are defined by setup.py according to the
+// environment variable LIBSEMIGROUPS_PYBIND11_ELEMENTS.
+
+#ifndef SRC_ELEMENTS_HPP_
+#define SRC_ELEMENTS_HPP_
+
+// C++ stl headers....
+#include <vector>  // for vector
+
+#ifndef LIBSEMIGROUPS_PYBIND11_SELECT_ELEMENTS
+#define LIBSEMIGROUPS_PYBIND11_ENABLE_TRANSF16
+#define LIBSEMIGROUPS_PYBIND11_ENABLE_TRANSF1
+#define LIBSEMIGROUPS_PYBIND11_ENABLE_TRANSF2
+#define LIBSEMIGROUPS_PYBIND11_ENABLE_TRANSF4
+#define LIBSEMIGROUPS_PYBIND11_ENABLE_PPERM16
+#define LIBSEMIGROUPS_PYBIND11_ENABLE_PPERM1
+#define LIBSEMIGROUPS_PYBIND11_ENABLE_PPERM2
+#define LIBSEMIGROUPS_PYBIND11_ENABLE_PPERM4
+#define LIBSEMIGROUPS_PYBIND11_ENABLE_PERM16
+#define LIBSEMIGROUPS_PYBIND11_ENABLE_PERM1
+#define LIBSEMIGROUPS_PYBIND11_ENABLE_PERM2
+#define LIBSEMIGROUPS_PYBIND11_ENABLE_PERM4
+#define LIBSEMIGROUPS_PYBIND11_ENABLE_BIPARTITION
+#define LIBSEMIGROUPS_PYBIND11_ENABLE_PBR
+#define LIBSEMIGROUPS_PYBIND11_ENABLE_BMAT8
+#define LIBSEMIGROUPS_PYBIND11_ENABLE_BMAT
+#define LIBSEMIGROUPS_PYBIND11_ENABLE_INTMAT
+#define LIBSEMIGROUPS_PYBIND11_ENABLE_MAXPLUSMAT
+#define LIBSEMIGROUPS_PYBIND11_ENABLE_MINPLUSMAT
+#define LIBSEMIGROUPS_PYBIND11_ENABLE_PROJMAXPLUSMAT
+#define LIBSEMIGROUPS_PYBIND11_ENABLE_MAXPLUSTRUNCMAT
+#define LIBSEMIGROUPS_PYBIND11_ENABLE_MINPLUSTRUNCMAT
+#define LIBSEMIGROUPS_PYBIND11_ENABLE_NTPMAT
+#endif
+
+// PermN is bound as a subclass of TransfN, and so requires TransfN.
+#if defined(LIBSEMIGROUPS_PYBIND11_ENABLE_PERM16) \
+    && !defined(LIBSEMIGROUPS_PYBIND11_ENABLE_TRANSF16)
+#define LIBSEMIGROUPS_PYBIND11_ENABLE_TRANSF16
+#endif
+#if defined(LIBSEMIGROUPS_PYBIND11_ENABLE_PERM1) \
+    && !defined(LIBSEMIGROUPS_PYBIND11_ENABLE_TRANSF1)
+#define LIBSEMIGROUPS_PYBIND11_ENABLE_TRANSF1
+#endif
+#if defined(LIBSEMIGROUPS_PYBIND11_ENABLE_PERM2) \
+    && !defined(LIBSEMIGROUPS_PYBIND11_ENABLE_TRANSF2)
+#define LIBSEMIGROUPS_PYBIND11_ENABLE_TRANSF2
+#endif
+#if defined(LIBSEMIGROUPS_PYBIND11_ENABLE_PERM4) \
+    && !defined(LIBSEMIGROUPS_PYBIND11_ENABLE_TRANSF4)
+#define LIBSEMIGROUPS_PYBIND11_ENABLE_TRANSF4
+#endif
+
+namespace libsemigroups {
+  namespace libsemigroups_pybind11 {
+
+    // Returns the Python names of the element types that are bound.
+    inline std::vector<char const*> enabled_elements() {
+      return {
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_TRANSF16
+          "Transf16",
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_TRANSF1
+          "Transf1",
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_TRANSF2
+          "Transf2",
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_TRANSF4
+          "Transf4",
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_PPERM16
+          "PPerm16",
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_PPERM1
+          "PPerm1",
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_PPERM2
+          "PPerm2",
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_PPERM4
+          "PPerm4",
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_PERM16
+          "Perm16",
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_PERM1
+          "Perm1",
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_PERM2
+          "Perm2",
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_PERM4
+          "Perm4",
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_BIPARTITION
+          "Bipartition",
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_PBR
+          "PBR",
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_BMAT8
+          "BMat8",
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_BMAT
+          "BMat",
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_INTMAT
+          "IntMat",
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_MAXPLUSMAT
+          "MaxPlusMat",
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_MINPLUSMAT
+          "MinPlusMat",
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_PROJMAXPLUSMAT
+          "ProjMaxPlusMat",
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_MAXPLUSTRUNCMAT
+          "MaxPlusTruncMat",
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_MINPLUSTRUNCMAT
+          "MinPlusTruncMat",
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_NTPMAT
+          "NTPMat",
+#endif
+      };
+    }
+  }  // namespace libsemigroups_pybind11
+}  // namespace libsemigroups
+
+#endif  // SRC_ELEMENTS_HPP_
@@ -41,7 +41,9 @@
 #include <pybind11/stl.h>
 
 // libsemigroups_pybind11....
-#include "main.hpp"  // for init_fpsemi
+#include "doc-strings.hpp"  // for run_until_cancelled
+#include "main.hpp"         // for init_fpsemi
+#include "runner.hpp"       // for run_until, run_until_cancelled
 
 namespace libsemigroups {
   class FroidurePinBase;
@@ -300,6 +302,7 @@ namespace libsemigroups {
                )pbdoc")
         .def("run",
              &FpSemigroup::run,
+             py::call_guard<py::gil_scoped_release>(),
              R"pbdoc(
                Run the algorithm.
 
@@ -309,6 +312,7 @@ namespace libsemigroups {
              (void (FpSemigroup::*)(std::chrono::nanoseconds))
                  & Runner::run_for,
              py::arg("t"),
+             py::call_guard<py::gil_scoped_release>(),
              R"pbdoc(
                Run for a specified amount of time.
 
@@ -317,17 +321,28 @@ namespace libsemigroups {
                :Returns: (None)
                )pbdoc")
         .def("run_until",
-             (void (FpSemigroup::*)(std::function<bool()>&))
-                 & Runner::run_until,
+             &libsemigroups_pybind11::run_until<FpSemigroup>,
              py::arg("func"),
+             py::arg("poll") = std::chrono::nanoseconds(0),
              R"pbdoc(
                Run until a nullary predicate returns ``True`` or the algorithm
                is finished.
 
-               :Parameters: **func** (Callable[], bool) - the nullary predicate.
+               The GIL is released while the algorithm runs, and is only
+               reacquired to call ``func``.
+
+               :Parameters: - **func** (Callable[], bool) - the nullary
+                              predicate.
+                            - **poll** (datetime.timedelta) - the minimum time
+                              between calls to ``func`` (default: every time
+                              the algorithm checks if it should stop).
 
                :Returns: (None)
                )pbdoc")
+        .def("run_until",
+             &libsemigroups_pybind11::run_until_cancelled<FpSemigroup>,
+             py::arg("token"),
+             runner_doc_strings::run_until_cancelled)
         .def("dead",
              &FpSemigroup::dead,
              R"pbdoc(
@@ -20,23 +20,26 @@
 #include <stddef.h>  // for size_t
 
 // C++ stl headers....
-#include <algorithm>         // for fill, copy
+#include <algorithm>         // for fill, copy, sort
 #include <array>             // for array
-#include <chrono>            // for nanoseconds
+#include <chrono>            // for nanoseconds, seconds
 #include <cstdint>           // for uint16_t, uint32_t, uint8_t
 #include <functional>        // for __base, function
 #include <initializer_list>  // for initializer_list
 #include <memory>            // for allocator, shared_ptr
 #include <ostream>           // for operator<<, string, ostringstream
 #include <string>            // for char_traits, operator+, basic_st...
+#include <type_traits>       // for true_type, false_type
 #include <unordered_map>     // for operator==, operator!=
+#include <utility>           // for move
 #include <vector>            // for vector
 
 // libsemigroups....
 #include <libsemigroups/bipart.hpp>             // for Bipartition
 #include <libsemigroups/bmat8.hpp>              // for BMat8
-#include <libsemigroups/constants.hpp>          // for operator==
+#include <libsemigroups/constants.hpp>          // for UNDEFINED, operator==
 #include <libsemigroups/containers.hpp>         // for DynamicArray2
+#include <libsemigroups/exception.hpp>          // for LIBSEMIGROUPS_EXCEPTION
 #include <libsemigroups/froidure-pin-base.hpp>  // for FroidurePinBase
 #include <libsemigroups/froidure-pin.hpp>  // for FroidurePin<>::element_index_type
 #include <libsemigroups/kbe.hpp>     // for KBE, FroidurePin<>::factorisation
@@ -55,7 +58,11 @@
 
 // libsemigroups_pybind11....
 #include "doc-strings.hpp"  // for dead, finished, kill, report
+#include "elements.hpp"     // for LIBSEMIGROUPS_PYBIND11_ENABLE_TRANSF16, ...
 #include "main.hpp"         // for init_froidure_pin
+#include "numpy.hpp"        // for readonly_table, throw_if_exported, ...
+#include "parallel.hpp"     // for parallel_for
+#include "runner.hpp"       // for run_until, run_with_stats
 
 namespace libsemigroups {
   namespace fpsemigroup {
@@ -66,19 +73,6 @@ namespace libsemigroups {
 namespace libsemigroups {
   namespace {
 
-    template <typename T>
-    py::list convert(detail::DynamicArray2<T> const& da) {
-      py::list result;
-      for (size_t i = 0; i < da.number_of_rows(); ++i) {
-        py::list row;
-        for (size_t j = 0; j < da.number_of_cols(); ++j) {
-          row.append(da.get(i, j));
-        }
-        result.append(row);
-      }
-      return result;
-    }
-
     template <typename T>
     std::string froidure_pin_repr(T& fp) {
       std::ostringstream out;
@@ -95,11 +89,174 @@ namespace libsemigroups {
       return out.str();
     }
 
+    py::dict froidure_pin_stats(FroidurePinBase const& fp) {
+      py::dict result;
+      result["current_size"]            = fp.current_size();
+      result["current_number_of_rules"] = fp.current_number_of_rules();
+      result["current_max_word_length"] = fp.current_max_word_length();
+      result["finished"]                = fp.finished();
+      return result;
+    }
+
+    // Fully enumerates fp, and returns the read-only array of indices
+    // returned by f(fp), which is cached in the attribute name of the Python
+    // object wrapping fp. The cached array is only reused if fp has the same
+    // number of generators as when the array was computed, since a fully
+    // enumerated FroidurePin can only change if generators are added.
+    template <typename T, typename F>
+    py::array_t<element_index_type> cached_indices(T&          fp,
+                                                   char const* name,
+                                                   F&&         f) {
+      {
+        py::gil_scoped_release release;
+        fp.run();
+      }
+      py::object self   = libsemigroups_pybind11::owner(fp);
+      py::object cached = py::getattr(self, name, py::none());
+      if (!cached.is_none()) {
+        auto pair = cached.cast<py::tuple>();
+        if (pair[0].cast<size_t>() == fp.number_of_generators()) {
+          return pair[1].cast<py::array_t<element_index_type>>();
+        }
+      }
+      std::vector<element_index_type> indices;
+      {
+        py::gil_scoped_release release;
+        indices = f(fp);
+      }
+      auto result = libsemigroups_pybind11::to_array(std::move(indices));
+      result.attr("setflags")(py::arg("write") = false);
+      py::setattr(
+          self, name, py::make_tuple(fp.number_of_generators(), result));
+      return result;
+    }
+
+    template <typename T>
+    std::vector<element_index_type> idempotent_indices(T& fp) {
+      std::vector<element_index_type> result;
+      result.reserve(fp.number_of_idempotents());
+      for (element_index_type i = 0; i < fp.size(); ++i) {
+        if (fp.is_idempotent(i)) {
+          result.push_back(i);
+        }
+      }
+      return result;
+    }
+
+    template <typename T>
+    std::vector<element_index_type> sorted_positions(T& fp) {
+      std::vector<element_index_type> result(fp.size());
+      for (element_index_type i = 0; i < result.size(); ++i) {
+        result[fp.position_to_sorted_position(i)] = i;
+      }
+      return result;
+    }
+
+    // Returns the sorted positions in fp of the elements of the subsemigroup
+    // generated by the generators of fp with indices in gens. These are the
+    // nodes reachable from those generators in the right Cayley graph of fp
+    // along edges labelled by gens, and so no elements are copied or
+    // multiplied. Fully enumerates fp.
+    template <typename T>
+    std::vector<element_index_type>
+    subsemigroup_positions(T& fp, std::vector<letter_type> const& gens) {
+      for (auto a : gens) {
+        if (a >= fp.number_of_generators()) {
+          LIBSEMIGROUPS_EXCEPTION("generator index out of bounds, expected "
+                                  "value in [0, %llu), got %llu",
+                                  uint64_t(fp.number_of_generators()),
+                                  uint64_t(a));
+        }
+      }
+      fp.run();
+      auto const&                     right = fp.right_cayley_graph();
+      std::vector<bool>               seen(fp.size(), false);
+      std::vector<element_index_type> result;
+
+      auto visit = [&seen, &result](size_t pos) {
+        if (!seen[pos]) {
+          seen[pos] = true;
+          result.push_back(pos);
+        }
+      };
+      for (auto a : gens) {
+        visit(fp.current_position(fp.generator(a)));
+      }
+      for (size_t i = 0; i < result.size(); ++i) {
+        for (auto a : gens) {
+          visit(right.get(result[i], a));
+        }
+      }
+      std::sort(result.begin(), result.end());
+      return result;
+    }
+
+    // Returns the element indices in the array-like object obj, which must be
+    // integers, see integer_array. If bound is not UNDEFINED, then every
+    // index must also be less than bound, since the functions applied to
+    // them with the GIL released do not check their arguments.
+    inline libsemigroups_pybind11::input_array<element_index_type>
+    element_indices(py::object const& obj, size_t bound) {
+      auto result
+          = libsemigroups_pybind11::integer_array<element_index_type>(obj);
+      if (bound != UNDEFINED) {
+        element_index_type const* in = result.data();
+        for (py::ssize_t i = 0; i < result.size(); ++i) {
+          if (in[i] >= bound) {
+            LIBSEMIGROUPS_EXCEPTION("element index out of bounds, expected "
+                                    "value in [0, %llu), got %llu",
+                                    uint64_t(bound),
+                                    uint64_t(in[i]));
+          }
+        }
+      }
+      return result;
+    }
+
+    // Returns copies of fp, the i-th of which has the elements of colls[i]
+    // added as generators (or only the non-redundant ones if closure is
+    // true), and is fully enumerated, using at most max_threads threads. Each
+    // thread only modifies its own copies, and only reads fp.
+    template <typename T>
+    std::vector<std::shared_ptr<T>> copy_add_generators_many(
+        T const&                                                  fp,
+        std::vector<std::vector<typename T::element_type>> const& colls,
+        bool                                                      closure,
+        size_t                                                    max_threads) {
+      std::vector<std::shared_ptr<T>> result(colls.size());
+      py::gil_scoped_release          release;
+      libsemigroups_pybind11::parallel_for(
+          colls.size(), max_threads, [&](size_t i) {
+            auto copy = std::make_shared<T>(fp);
+            if (closure) {
+              copy->closure(colls[i]);
+            } else {
+              copy->add_generators(colls[i]);
+            }
+            copy->run();
+            result[i] = std::move(copy);
+          });
+      return result;
+    }
+
+    // The element types that cannot be pickled, since they refer to another
+    // object, and so neither can FroidurePin instances over them.
+    template <typename T>
+    struct is_picklable : std::true_type {};
+
+    template <>
+    struct is_picklable<detail::KBE> : std::false_type {};
+
+    template <>
+    struct is_picklable<detail::TCE> : std::false_type {};
+
     template <typename T, typename S = FroidurePinTraits<T>>
     void bind_froidure_pin(py::module& m, std::string typestr) {
       using Class              = FroidurePin<T, S>;
       using element_type       = typename FroidurePin<T, S>::element_type;
       using const_reference    = typename FroidurePin<T, S>::const_reference;
+      using libsemigroups_pybind11::throw_if_exported;
+      using libsemigroups_pybind11::vectorize;
       std::string pyclass_name = std::string("FroidurePin") + typestr;
       py::class_<Class, std::shared_ptr<Class>, FroidurePinBase> x(
           m, pyclass_name.c_str(), py::buffer_protocol(), py::dynamic_attr());
@@ -109,7 +266,14 @@ namespace libsemigroups {
       x.def(py::init<std::vector<element_type> const&>(), py::arg("coll"))
           .def(py::init<Class const&>(), py::arg("that"))
           .def("size", &Class::size)
-          .def("add_generator", &Class::add_generator, py::arg("x"))
+          .def(
+              "add_generator",
+              [](Class& x, const_reference y) {
+                throw_if_exported(x);
+                py::gil_scoped_release release;
+                x.add_generator(y);
+              },
+              py::arg("x"))
           .def("number_of_generators", &Class::number_of_generators)
           .def("batch_size",
                py::overload_cast<size_t>(&Class::batch_size),
@@ -126,7 +290,13 @@ namespace libsemigroups {
                py::arg("thrshld"))
           .def("concurrency_threshold",
                py::overload_cast<>(&Class::concurrency_threshold, py::const_))
-          .def("reserve", &Class::reserve)
+          .def(
+              "reserve",
+              [](Class& x, size_t val) {
+                throw_if_exported(x);
+                x.reserve(val);
+              },
+              py::arg("val"))
           .def("immutable",
                py::overload_cast<bool>(&Class::immutable),
                py::arg("val"))
@@ -135,11 +305,28 @@ namespace libsemigroups {
           .def("current_size", [](Class const& x) { return x.current_size(); })
           .def("current_number_of_rules",
                [](Class const& x) { return x.current_number_of_rules(); })
-          .def("enumerate", &FroidurePinBase::enumerate, py::arg("limit"))
+          .def("enumerate",
+               &FroidurePinBase::enumerate,
+               py::arg("limit"),
+               py::call_guard<py::gil_scoped_release>())
           .def("right_cayley_graph",
-               [](Class& x) { return convert(x.right_cayley_graph()); })
+               [](Class& x) {
+                 {
+                   py::gil_scoped_release release;
+                   x.run();
+                 }
+                 return libsemigroups_pybind11::readonly_table(
+                     x.right_cayley_graph(), x);
+               })
           .def("left_cayley_graph",
-               [](Class& x) { return convert(x.left_cayley_graph()); })
+               [](Class& x) {
+                 {
+                   py::gil_scoped_release release;
+                   x.run();
+                 }
+                 return libsemigroups_pybind11::readonly_table(
+                     x.left_cayley_graph(), x);
+               })
           .def("current_max_word_length",
                [](Class const& x) { return x.current_max_word_length(); })
           .def("current_position",
@@ -182,19 +369,53 @@ namespace libsemigroups {
           .def("first_letter", &FroidurePinBase::first_letter, py::arg("pos"))
           .def("final_letter", &FroidurePinBase::final_letter, py::arg("pos"))
           .def("degree", [](Class const& x) { return x.degree(); })
-          .def("run", &Class::run, runner_doc_strings::run)
+          .def("run",
+               &Class::run,
+               py::call_guard<py::gil_scoped_release>(),
+               runner_doc_strings::run)
           .def("run_for",
                (void(Class::  // NOLINT(whitespace/parens)
                          *)(std::chrono::nanoseconds))
                    & Runner::run_for,
                py::arg("t"),
+               py::call_guard<py::gil_scoped_release>(),
                runner_doc_strings::run_for)
           .def("run_until",
-               (void(Class::  // NOLINT(whitespace/parens)
-                         *)(std::function<bool()>&))
-                   & Runner::run_until,
+               &libsemigroups_pybind11::run_until<Class>,
                py::arg("func"),
+               py::arg("poll") = std::chrono::nanoseconds(0),
                runner_doc_strings::run_until)
+          .def("run_until",
+               &libsemigroups_pybind11::run_until_cancelled<Class>,
+               py::arg("token"),
+               runner_doc_strings::run_until_cancelled)
+          .def(
+              "run_with_stats",
+              [](Class&                   x,
+                 py::function             func,
+                 std::chrono::nanoseconds interval) {
+                libsemigroups_pybind11::run_with_stats(
+                    x, func, interval, &froidure_pin_stats);
+              },
+              py::arg("func"),
+              py::arg("interval") = std::chrono::seconds(1),
+              runner_doc_strings::run_with_stats)
+          .def("stats",
+               &froidure_pin_stats,
+               R"pbdoc(
+                 Returns a dictionary containing the current values of some
+                 counters.
+
+                 The keys are ``"current_size"``,
+                 ``"current_number_of_rules"``, and
+                 ``"current_max_word_length"``, whose values are those of the
+                 functions with the same names, and ``"finished"``. These
+                 values are only approximate if this is running in another
+                 thread; use :py:meth:`run_with_stats` to monitor a run.
+
+                 :Parameters: None
+                 :return: A ``dict``.
+               )pbdoc")
           .def("kill", &Class::kill, runner_doc_strings::kill)
           .def("dead", &Class::dead, runner_doc_strings::dead)
           .def("finished", &Class::finished, runner_doc_strings::finished)
@@ -221,12 +442,16 @@ namespace libsemigroups {
           .def(
               "add_generators",
               [](Class& x, std::vector<element_type> const& y) {
+                throw_if_exported(x);
+                py::gil_scoped_release release;
                 x.add_generators(y);
               },
               py::arg("coll"))
           .def(
               "closure",
               [](Class& x, std::vector<element_type> const& y) {
+                throw_if_exported(x);
+                py::gil_scoped_release release;
                 x.closure(y);
               },
               py::arg("coll"))
@@ -235,13 +460,44 @@ namespace libsemigroups {
               [](Class& x, std::vector<element_type> const& y) {
                 return x.copy_add_generators(y);
               },
-              py::arg("coll"))
+              py::arg("coll"),
+              py::call_guard<py::gil_scoped_release>())
           .def(
               "copy_closure",
               [](Class& x, std::vector<element_type> const& y) {
                 return x.copy_closure(y);
               },
-              py::arg("coll"))
+              py::arg("coll"),
+              py::call_guard<py::gil_scoped_release>())
+          .def(
+              "copy_add_generators_many",
+              [](Class const&                                  x,
+                 std::vector<std::vector<element_type>> const& colls,
+                 size_t                                        max_threads) {
+                return copy_add_generators_many(x, colls, false, max_threads);
+              },
+              py::arg("colls"),
+              py::arg("max_threads") = 1)
+          .def(
+              "copy_closure_many",
+              [](Class const&                                  x,
+                 std::vector<std::vector<element_type>> const& colls,
+                 size_t                                        max_threads) {
+                return copy_add_generators_many(x, colls, true, max_threads);
+              },
+              py::arg("colls"),
+              py::arg("max_threads") = 1)
+          .def(
+              "subsemigroup_positions",
+              [](Class& x, std::vector<letter_type> const& gens) {
+                std::vector<element_index_type> result;
+                {
+                  py::gil_scoped_release release;
+                  result = subsemigroup_positions(x, gens);
+                }
+                return libsemigroups_pybind11::to_array(std::move(result));
+              },
+              py::arg("gens"))
           .def("word_to_element", &Class::word_to_element, py::arg("w"))
           .def("generator", &Class::generator, py::arg("i"))
           .def("contains", &Class::contains, py::arg("x"))
@@ -262,6 +518,18 @@ namespace libsemigroups {
                  return py::make_iterator(x.cbegin_idempotents(),
                                           x.cend_idempotents());
                })
+          .def(
+              "idempotent_indices",
+              [](Class& x) {
+                return cached_indices(
+                    x, "_idempotent_indices", &idempotent_indices<Class>);
+              })
+          .def(
+              "sorted_positions",
+              [](Class& x) {
+                return cached_indices(
+                    x, "_sorted_positions", &sorted_positions<Class>);
+              })
           .def("number_of_idempotents", &Class::number_of_idempotents)
           .def("is_idempotent", &Class::is_idempotent, py::arg("i"))
           .def("position_to_sorted_position",
@@ -270,7 +538,132 @@ namespace libsemigroups {
           .def("is_finite", &Class::is_finite)
           .def("equal_to", &Class::equal_to, py::arg("x"), py::arg("y"))
           .def("fast_product", &Class::fast_product, py::arg("i"), py::arg("j"))
-          .def("__repr__", &froidure_pin_repr<Class>);
+          .def(
+              "fast_products",
+              [](Class const& x, py::object const& i, py::object const& j) {
+                return vectorize<element_index_type>(
+                    element_indices(i, x.current_size()),
+                    element_indices(j, x.current_size()),
+                    [&x](element_index_type a, element_index_type b) {
+                      return x.fast_product(a, b);
+                    });
+              },
+              py::arg("i"),
+              py::arg("j"))
+          .def(
+              "products_by_reduction",
+              [](Class const& x, py::object const& i, py::object const& j) {
+                return vectorize<element_index_type>(
+                    element_indices(i, x.current_size()),
+                    element_indices(j, x.current_size()),
+                    [&x](element_index_type a, element_index_type b) {
+                      return x.product_by_reduction(a, b);
+                    });
+              },
+              py::arg("i"),
+              py::arg("j"))
+          .def(
+              "current_positions",
+              [](Class const& x, std::vector<word_type> const& words) {
+                return vectorize<element_index_type>(
+                    words,
+                    [&x](word_type const& w) { return x.current_position(w); });
+              },
+              py::arg("words"))
+          .def(
+              "current_positions",
+              [](Class const& x, std::vector<element_type> const& coll) {
+                return vectorize<element_index_type>(
+                    coll, [&x](element_type const& y) {
+                      return x.current_position(y);
+                    });
+              },
+              py::arg("coll"))
+          .def(
+              "positions",
+              [](Class& x, std::vector<element_type> const& coll) {
+                return vectorize<element_index_type>(
+                    coll,
+                    [&x](element_type const& y) { return x.position(y); });
+              },
+              py::arg("coll"))
+          .def(
+              "lengths",
+              [](Class& x, py::object const& pos) {
+                // length(i) enumerates x if necessary, and checks i.
+                return vectorize<size_t>(
+                    element_indices(pos, UNDEFINED),
+                    [&x](element_index_type i) { return x.length(i); });
+              },
+              py::arg("pos"))
+          .def(
+              "prefixes",
+              [](Class const& x, py::object const& pos) {
+                return vectorize<element_index_type>(
+                    element_indices(pos, x.current_size()),
+                    [&x](element_index_type i) { return x.prefix(i); });
+              },
+              py::arg("pos"))
+          .def(
+              "suffixes",
+              [](Class const& x, py::object const& pos) {
+                return vectorize<element_index_type>(
+                    element_indices(pos, x.current_size()),
+                    [&x](element_index_type i) { return x.suffix(i); });
+              },
+              py::arg("pos"))
+          .def(
+              "factorisations",
+              [](Class& x, py::object const& obj) {
+                // factorisation(w, i) enumerates x if necessary, and checks i.
+                auto const                pos = element_indices(obj, UNDEFINED);
+                std::vector<word_type>    result(pos.size());
+                element_index_type const* in = pos.data();
+                {
+                  py::gil_scoped_release release;
+                  for (size_t i = 0; i < result.size(); ++i) {
+                    x.factorisation(result[i], in[i]);
+                  }
+                }
+                return result;
+              },
+              py::arg("pos"))
+          .def("__repr__", &froidure_pin_repr<Class>)
+          .def(py::pickle(
+              [pyclass_name](Class const& x) {
+                if (!is_picklable<T>::value) {
+                  throw py::type_error("cannot pickle '" + pyclass_name
+                                       + "' object");
+                }
+                py::list gens;
+                for (size_t i = 0; i < x.number_of_generators(); ++i) {
+                  gens.append(py::cast(x.generator(i)));
+                }
+                return py::make_tuple(gens,
+                                      x.current_size(),
+                                      x.finished(),
+                                      x.batch_size(),
+                                      x.max_threads(),
+                                      x.concurrency_threshold());
+              },
+              [](py::tuple state) {
+                auto result = std::make_shared<Class>(
+                    state[0].cast<std::vector<element_type>>());
+                result->batch_size(state[3].cast<size_t>());
+                result->max_threads(state[4].cast<size_t>());
+                result->concurrency_threshold(state[5].cast<size_t>());
+                size_t const size     = state[1].cast<size_t>();
+                bool const   finished = state[2].cast<bool>();
+                {
+                  py::gil_scoped_release release;
+                  if (finished) {
+                    result->run();
+                  } else {
+                    result->enumerate(size);
+                  }
+                }
+                return result;
+              }));
     }
   }  // namespace
 
@@ -278,35 +671,81 @@ namespace libsemigroups {
     py::class_<FroidurePinBase, std::shared_ptr<FroidurePinBase>>(
         m, "FroidurePinBase");
 
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_TRANSF16
     bind_froidure_pin<LeastTransf<16>>(m, "Transf16");
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_TRANSF1
     bind_froidure_pin<Transf<0, uint8_t>>(m, "Transf1");
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_TRANSF2
     bind_froidure_pin<Transf<0, uint16_t>>(m, "Transf2");
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_TRANSF4
     bind_froidure_pin<Transf<0, uint32_t>>(m, "Transf4");
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_PPERM16
     bind_froidure_pin<LeastPPerm<16>>(m, "PPerm16");
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_PPERM1
     bind_froidure_pin<PPerm<0, uint8_t>>(m, "PPerm1");
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_PPERM2
     bind_froidure_pin<PPerm<0, uint16_t>>(m, "PPerm2");
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_PPERM4
     bind_froidure_pin<PPerm<0, uint32_t>>(m, "PPerm4");
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_PERM16
     bind_froidure_pin<LeastPerm<16>>(m, "Perm16");
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_PERM1
     bind_froidure_pin<Perm<0, uint8_t>>(m, "Perm1");
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_PERM2
     bind_froidure_pin<Perm<0, uint16_t>>(m, "Perm2");
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_PERM4
     bind_froidure_pin<Perm<0, uint32_t>>(m, "Perm4");
+#endif
     bind_froidure_pin<detail::KBE,
                       FroidurePinTraits<detail::KBE, fpsemigroup::KnuthBendix>>(
         m, "KBE");
     bind_froidure_pin<detail::TCE,
                       FroidurePinTraits<detail::TCE, detail::TCE::Table>>(
         m, "TCE");
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_BIPARTITION
     bind_froidure_pin<Bipartition>(m, "Bipartition");
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_PBR
     bind_froidure_pin<PBR>(m, "PBR");
+#endif
 
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_BMAT8
     bind_froidure_pin<BMat8>(m, "BMat8");
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_BMAT
     bind_froidure_pin<BMat<>>(m, "BMat");
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_INTMAT
     bind_froidure_pin<IntMat<>>(m, "IntMat");
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_MAXPLUSMAT
     bind_froidure_pin<MaxPlusMat<>>(m, "MaxPlusMat");
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_MINPLUSMAT
     bind_froidure_pin<MinPlusMat<>>(m, "MinPlusMat");
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_PROJMAXPLUSMAT
     bind_froidure_pin<ProjMaxPlusMat<>>(m, "ProjMaxPlusMat");
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_MAXPLUSTRUNCMAT
     bind_froidure_pin<MaxPlusTruncMat<>>(m, "MaxPlusTruncMat");
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_MINPLUSTRUNCMAT
     bind_froidure_pin<MinPlusTruncMat<>>(m, "MinPlusTruncMat");
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_NTPMAT
     bind_froidure_pin<NTPMat<>>(m, "NTPMat");
+#endif
   }
 }  // namespace libsemigroups
@@ -17,23 +17,114 @@
 //
 
 // C std headers....
+#include <stddef.h>  // for size_t
+
 // C++ stl headers....
+#include <string>  // for string
+#include <vector>  // for vector
 
 // libsemigroups....
-#include <libsemigroups/kambites.hpp>  // for Kambites
-#include <libsemigroups/types.hpp>     // for rule_type
+#include <libsemigroups/exception.hpp>  // for LIBSEMIGROUPS_EXCEPTION
+#include <libsemigroups/kambites.hpp>   // for Kambites
+#include <libsemigroups/types.hpp>      // for rule_type, word_type
 
 // pybind11....
+#include <pybind11/chrono.h>    // for auto conversion of py types for run_for
+#include <pybind11/numpy.h>     // for array_t
 #include <pybind11/pybind11.h>  // for class_, init, module
 #include <pybind11/stl.h>
 
 // libsemigroups_pybind11....
 #include "doc-strings.hpp"  // for init_kambites
 #include "main.hpp"         // for init_kambites
+#include "parallel.hpp"     // for number_of_threads, parallel_for_ranges
+#include "runner.hpp"       // for run_until, run_until_cancelled
 
 namespace py = pybind11;
 
 namespace libsemigroups {
+  namespace {
+    using Kambites_ = fpsemigroup::Kambites<detail::MultiStringView>;
+
+    // Calls f(x, i) for every i in [0, n), using at most max_threads threads,
+    // where x is k in the calling thread, and a copy of k in every other
+    // thread. Kambites caches data (such as the decompositions of the
+    // relation words) while checking equality, and so a single instance
+    // cannot be used in several threads at once. The suffix tree and the
+    // pieces of the relation words are computed before k is copied, so that
+    // this is done only once. The GIL must not be held when calling this.
+    template <typename F>
+    void for_each_index(Kambites_& k, size_t n, size_t max_threads, F&& f) {
+      size_t const c = k.small_overlap_class();
+      if (c < 4) {
+        LIBSEMIGROUPS_EXCEPTION(
+            "the small overlap class must be at least 4, found %llu",
+            static_cast<unsigned long long>(c));
+      }
+      size_t const nr_threads
+          = libsemigroups_pybind11::number_of_threads(n, max_threads);
+      std::vector<Kambites_> copies(nr_threads - 1, k);
+      libsemigroups_pybind11::parallel_for_ranges(
+          n,
+          nr_threads,
+          [&k, &copies, &f](size_t t, size_t first, size_t last) {
+            Kambites_& x = (t == 0 ? k : copies[t - 1]);
+            for (size_t i = first; i < last; ++i) {
+              f(x, i);
+            }
+          });
+    }
+
+    // Kambites::normal_form hides the overload for word_type in
+    // FpSemigroupInterface.
+    std::string normal_form(Kambites_& k, std::string const& w) {
+      return k.normal_form(w);
+    }
+
+    word_type normal_form(Kambites_& k, word_type const& w) {
+      return static_cast<FpSemigroupInterface&>(k).normal_form(w);
+    }
+
+    template <typename W>
+    py::array_t<bool> equal_to_many(Kambites_&            k,
+                                    std::vector<W> const& us,
+                                    std::vector<W> const& vs,
+                                    size_t                max_threads) {
+      if (us.size() != vs.size()) {
+        LIBSEMIGROUPS_EXCEPTION("the arguments must have the same length, "
+                                "found %llu and %llu",
+                                static_cast<unsigned long long>(us.size()),
+                                static_cast<unsigned long long>(vs.size()));
+      }
+      py::array_t<bool> result(us.size());
+      bool*             out = result.mutable_data();
+      {
+        py::gil_scoped_release release;
+        for_each_index(
+            k, us.size(), max_threads, [&us, &vs, out](Kambites_& x, size_t i) {
+              out[i] = x.equal_to(us[i], vs[i]);
+            });
+      }
+      return result;
+    }
+
+    template <typename W>
+    std::vector<W> normal_form_many(Kambites_&            k,
+                                    std::vector<W> const& words,
+                                    size_t                max_threads) {
+      std::vector<W> result(words.size());
+      {
+        py::gil_scoped_release release;
+        for_each_index(
+            k, words.size(), max_threads, [&words, &result](Kambites_& x,
+                                                            size_t     i) {
+              result[i] = normal_form(x, words[i]);
+            });
+      }
+      return result;
+    }
+  }  // namespace
+
   void init_kambites(py::module& m) {
     using detail::MultiStringView;
     using string_type =
@@ -422,6 +513,91 @@ namespace libsemigroups {
                  element of the finitely presented semigroup, and ``False``
                  otherwise.
              )pbdoc")
+        .def(
+            "equal_to_many",
+            [](Kambites_&                      k,
+               std::vector<std::string> const& us,
+               std::vector<std::string> const& vs,
+               size_t                          max_threads) {
+              return equal_to_many(k, us, vs, max_threads);
+            },
+            py::arg("us"),
+            py::arg("vs"),
+            py::arg("max_threads") = 1,
+            R"pbdoc(
+              Check if many pairs of words represent the same elements.
+
+              The ``i``-th entry of the returned array is :py:meth:`equal_to`
+              of ``us[i]`` and ``vs[i]``. The GIL is released, and if
+              ``max_threads`` is not ``1``, then every thread other than the
+              calling thread uses its own copy of this, made after the pieces
+              of the relation words have been computed.
+
+              :param us: the first words (``List[str]`` or ``List[List[int]]``).
+              :type us: list
+              :param vs: the second words (of the same type as ``us``).
+              :type vs: list
+              :param max_threads:
+                the maximum number of threads to use, or ``0`` for the number
+                of threads supported by the hardware.
+              :type max_threads: int
+
+              :return:
+                A ``numpy.ndarray`` of ``bool`` whose ``i``-th entry is
+                ``True`` if ``us[i]`` and ``vs[i]`` represent the same element.
+
+              :Raises:
+                ``RuntimeError`` if ``us`` and ``vs`` have different lengths,
+                or if the small overlap class is less than ``4``.
+            )pbdoc")
+        .def(
+            "equal_to_many",
+            [](Kambites_&                    k,
+               std::vector<word_type> const& us,
+               std::vector<word_type> const& vs,
+               size_t                        max_threads) {
+              return equal_to_many(k, us, vs, max_threads);
+            },
+            py::arg("us"),
+            py::arg("vs"),
+            py::arg("max_threads") = 1)
+        .def(
+            "normal_form_many",
+            [](Kambites_&                      k,
+               std::vector<std::string> const& words,
+               size_t                          max_threads) {
+              return normal_form_many(k, words, max_threads);
+            },
+            py::arg("words"),
+            py::arg("max_threads") = 1,
+            R"pbdoc(
+              Returns the normal forms of many words.
+
+              The ``i``-th entry of the returned list is :py:meth:`normal_form`
+              of ``words[i]``. The threads are used as in
+              :py:meth:`equal_to_many`.
+
+              :param words: the words (``List[str]`` or ``List[List[int]]``).
+              :type words: list
+              :param max_threads:
+                the maximum number of threads to use, or ``0`` for the number
+                of threads supported by the hardware.
+              :type max_threads: int
+
+              :return: A list of the normal forms, of the same type as ``words``.
+
+              :Raises:
+                ``RuntimeError`` if the small overlap class is less than ``4``.
+            )pbdoc")
+        .def(
+            "normal_form_many",
+            [](Kambites_&                    k,
+               std::vector<word_type> const& words,
+               size_t                        max_threads) {
+              return normal_form_many(k, words, max_threads);
+            },
+            py::arg("words"),
+            py::arg("max_threads") = 1)
         .def("has_identity",
              &fpsemigroup::Kambites<MultiStringView>::has_identity,
              R"pbdoc(
@@ -460,19 +636,26 @@ namespace libsemigroups {
              runner_doc_strings::kill)
         .def("run",
              &fpsemigroup::Kambites<MultiStringView>::run,
+             py::call_guard<py::gil_scoped_release>(),
              runner_doc_strings::run)
         .def("run_for",
              (void(fpsemigroup::Kambites<  // NOLINT(whitespace/parens)
                    MultiStringView>::*)(std::chrono::nanoseconds))
                  & Runner::run_for,
              py::arg("t"),
+             py::call_guard<py::gil_scoped_release>(),
              runner_doc_strings::run_for)
         .def("run_until",
-             (void(fpsemigroup::Kambites<  // NOLINT(whitespace/parens)
-                   MultiStringView>::*)(std::function<bool()>&))
-                 & Runner::run_until,
+             &libsemigroups_pybind11::run_until<
+                 fpsemigroup::Kambites<MultiStringView>>,
              py::arg("func"),
+             py::arg("poll") = std::chrono::nanoseconds(0),
              runner_doc_strings::run_until)
+        .def("run_until",
+             &libsemigroups_pybind11::run_until_cancelled<
+                 fpsemigroup::Kambites<MultiStringView>>,
+             py::arg("token"),
+             runner_doc_strings::run_until_cancelled)
         .def("report_every",
              (void(fpsemigroup::Kambites<  // NOLINT(whitespace/parens)
                    MultiStringView>::*)(std::chrono::nanoseconds))
@@ -19,15 +19,20 @@
 #include <stddef.h>  // for size_t
 
 // C++ stl headers....
+#include <algorithm>         // for for_each
 #include <array>             // for array
-#include <chrono>            // for nanoseconds
+#include <chrono>            // for nanoseconds, seconds
 #include <functional>        // for __base, function
 #include <initializer_list>  // for initializer_list
 #include <iosfwd>            // for string
-#include <memory>            // for shared_ptr
+#include <memory>            // for shared_ptr, make_shared
+#include <set>               // for set
+#include <string>            // for string
+#include <utility>           // for make_pair, pair
 #include <vector>            // for vector
 
 // libsemigroups....
+#include <libsemigroups/exception.hpp>     // for LibsemigroupsException
 #include <libsemigroups/fpsemi-intf.hpp>  // for FpSemigroupInterface, FpSemigrou...
 #include <libsemigroups/knuth-bendix.hpp>  // for KnuthBendix, KnuthBendix::option...
 #include <libsemigroups/runner.hpp>        // for Runner
@@ -45,6 +50,9 @@
 // libsemigroups_pybind11....
 #include "doc-strings.hpp"  // for dead, finished, kill, report
 #include "main.hpp"         // for init_knuth_bendix
+#include "numpy.hpp"        // for flatten_words, unflatten_words, ...
+#include "parallel.hpp"     // for parallel_for
+#include "runner.hpp"       // for run_until, run_with_stats
 
 namespace py = pybind11;
 
@@ -71,6 +79,100 @@ namespace libsemigroups {
       return py::reinterpret_steal<py::str>(
           PyUnicode_DecodeLatin1(u.data(), u.length(), NULL));
     }
+
+    py::dict knuth_bendix_stats(fpsemigroup::KnuthBendix const& kb) {
+      py::dict result;
+      result["active_rules"] = kb.number_of_active_rules();
+      result["rules"]        = kb.number_of_rules();
+      result["finished"]     = kb.finished();
+      return result;
+    }
+
+    void rewrite_in_place(fpsemigroup::KnuthBendix const& kb, std::string& w) {
+      kb.rewrite(&w);
+    }
+
+    void rewrite_in_place(fpsemigroup::KnuthBendix const& kb, word_type& w) {
+      std::string s = kb.word_to_string(w);
+      kb.rewrite(&s);
+      w = kb.string_to_word(s);
+    }
+
+    // Rewrites every word in words in place, using at most max_threads
+    // threads, and after running kb to completion if normal_form is true.
+    // Only const member functions of kb are called from several threads,
+    // once kb is no longer running, and so the rules are not modified
+    // while they are being read.
+    template <typename Word>
+    void rewrite_many(fpsemigroup::KnuthBendix& kb,
+                      std::vector<Word>&        words,
+                      size_t                    max_threads,
+                      bool                      normal_form) {
+      py::gil_scoped_release release;
+      for (auto const& w : words) {
+        kb.validate_word(w);
+      }
+      if (normal_form) {
+        kb.run();
+      }
+      libsemigroups_pybind11::parallel_for(
+          words.size(), max_threads, [&kb, &words](size_t i) {
+            rewrite_in_place(kb, words[i]);
+          });
+    }
+
+    py::list rewrite_strings(fpsemigroup::KnuthBendix&       kb,
+                             std::vector<std::string> const& words,
+                             size_t                          max_threads,
+                             bool                            normal_form) {
+      std::vector<std::string> result;
+      result.reserve(words.size());
+      for (auto const& w : words) {
+        result.push_back(to_latin1(w));
+      }
+      rewrite_many(kb, result, max_threads, normal_form);
+      py::list out(result.size());
+      for (size_t i = 0; i < result.size(); ++i) {
+        out[i] = from_latin1(result[i]);
+      }
+      return out;
+    }
+
+    std::vector<word_type>
+    rewrite_words(fpsemigroup::KnuthBendix& kb,
+                  std::vector<word_type>    words,
+                  size_t                    max_threads,
+                  bool                      normal_form) {
+      rewrite_many(kb, words, max_threads, normal_form);
+      return words;
+    }
+
+    py::tuple rewrite_flat(fpsemigroup::KnuthBendix& kb,
+                           py::object const&         offsets,
+                           py::object const&         letters,
+                           size_t                    max_threads,
+                           bool                      normal_form) {
+      auto words = libsemigroups_pybind11::unflatten_words(offsets, letters);
+      rewrite_many(kb, words, max_threads, normal_form);
+      return libsemigroups_pybind11::flatten_words(words);
+    }
+
+    // KnuthBendix has no getters for its settings, and so the values passed
+    // to the setters are also recorded in the dict returned by this
+    // function, which is stored in the __dict__ of the Python object self,
+    // so that the settings can be pickled.
+    py::dict recorded_settings(py::object const& self) {
+      return self.attr("__dict__").attr("setdefault")("_settings", py::dict());
+    }
+
+    // Returns the inverses of kb, or the empty string if there are none.
+    std::string inverses_or_empty(fpsemigroup::KnuthBendix const& kb) {
+      try {
+        return kb.inverses();
+      } catch (LibsemigroupsException const&) {
+        return "";
+      }
+    }
   }  // namespace
 
   void init_knuth_bendix(py::module& m) {
@@ -89,7 +191,7 @@ namespace libsemigroups {
 
     py::class_<fpsemigroup::KnuthBendix,
                std::shared_ptr<fpsemigroup::KnuthBendix>>
-        kb(m, "KnuthBendix");
+        kb(m, "KnuthBendix", py::dynamic_attr());
 
     py::enum_<fpsemigroup::KnuthBendix::options::overlap>(kb,
                                                           "overlap",
@@ -133,6 +235,76 @@ namespace libsemigroups {
                       + detail::to_string(kb.number_of_active_rules())
                       + " active rules>";
              })
+        .def(py::pickle(
+            [](py::object const& self) {
+              auto const& kb = self.cast<fpsemigroup::KnuthBendix const&>();
+              py::list    rules;
+              auto        add = [&rules](rule_type const& rule) {
+                rules.append(py::make_tuple(py::bytes(rule.first),
+                                            py::bytes(rule.second)));
+              };
+              // Once finished, the active rules define the same congruence
+              // as the original rules, and are confluent, and so the
+              // unpickled instance does not redo the completion.
+              if (kb.finished()) {
+                auto active = kb.active_rules();
+                std::for_each(active.cbegin(), active.cend(), add);
+              } else {
+                std::for_each(kb.cbegin_rules(), kb.cend_rules(), add);
+              }
+              return py::make_tuple(
+                  py::bytes(kb.alphabet()),
+                  rules,
+                  py::bytes(kb.has_identity() ? kb.identity() : ""),
+                  py::bytes(inverses_or_empty(kb)),
+                  recorded_settings(self));
+            },
+            [](py::tuple state) {
+              auto kb       = std::make_shared<fpsemigroup::KnuthBendix>();
+              auto alphabet = state[0].cast<std::string>();
+              auto identity = state[2].cast<std::string>();
+              auto inverses = state[3].cast<std::string>();
+              auto settings = state[4].cast<py::dict>();
+              if (!alphabet.empty()) {
+                kb->set_alphabet(alphabet);
+              }
+              if (!identity.empty()) {
+                kb->set_identity(identity);
+              }
+              if (!inverses.empty()) {
+                kb->set_inverses(inverses);
+              }
+              // Setting the identity and inverses adds rules, which are
+              // also in state[1], and so these are not added twice.
+              std::set<rule_type> const added(kb->cbegin_rules(),
+                                              kb->cend_rules());
+              for (auto rule : state[1].cast<py::list>()) {
+                auto lhs_rhs = rule.cast<py::tuple>();
+                auto lhs     = lhs_rhs[0].cast<std::string>();
+                auto rhs     = lhs_rhs[1].cast<std::string>();
+                if (added.count(std::make_pair(lhs, rhs)) == 0) {
+                  kb->add_rule(lhs, rhs);
+                }
+              }
+              if (settings.contains("check_confluence_interval")) {
+                kb->check_confluence_interval(
+                    settings["check_confluence_interval"].cast<size_t>());
+              }
+              if (settings.contains("max_overlap")) {
+                kb->max_overlap(settings["max_overlap"].cast<size_t>());
+              }
+              if (settings.contains("max_rules")) {
+                kb->max_rules(settings["max_rules"].cast<size_t>());
+              }
+              if (settings.contains("overlap_policy")) {
+                kb->overlap_policy(
+                    settings["overlap_policy"]
+                        .cast<fpsemigroup::KnuthBendix::options::overlap>());
+              }
+              py::dict dict;
+              dict["_settings"] = settings;
+              return std::make_pair(kb, dict);
+            }))
         .def(
             "set_alphabet",
             [](fpsemigroup::KnuthBendix& kb, std::string const& a) {
@@ -515,14 +687,48 @@ namespace libsemigroups {
                        *)(std::chrono::nanoseconds))
                  & Runner::run_for,
              py::arg("t"),
+             py::call_guard<py::gil_scoped_release>(),
              runner_doc_strings::run_for)
         .def("run_until",
-             (void(fpsemigroup::KnuthBendix::  // NOLINT(whitespace/parens)
-                       *)(std::function<bool()>&))
-                 & Runner::run_until,
+             &libsemigroups_pybind11::run_until<fpsemigroup::KnuthBendix>,
              py::arg("func"),
+             py::arg("poll") = std::chrono::nanoseconds(0),
              runner_doc_strings::run_until)
-        .def("run", &fpsemigroup::KnuthBendix::run, runner_doc_strings::run)
+        .def("run_until",
+             &libsemigroups_pybind11::run_until_cancelled<
+                 fpsemigroup::KnuthBendix>,
+             py::arg("token"),
+             runner_doc_strings::run_until_cancelled)
+        .def(
+            "run_with_stats",
+            [](fpsemigroup::KnuthBendix& kb,
+               py::function              func,
+               std::chrono::nanoseconds  interval) {
+              libsemigroups_pybind11::run_with_stats(
+                  kb, func, interval, &knuth_bendix_stats);
+            },
+            py::arg("func"),
+            py::arg("interval") = std::chrono::seconds(1),
+            runner_doc_strings::run_with_stats)
+        .def("stats",
+             &knuth_bendix_stats,
+             R"pbdoc(
+               Returns a dictionary containing the current values of some
+               counters.
+
+               The keys are ``"active_rules"``, the current number of active
+               rules, ``"rules"``, the number of rules used to define the
+               finitely presented semigroup, and ``"finished"``. These values
+               are only approximate if this is running in another thread; use
+               :py:meth:`run_with_stats` to monitor a run.
+
+               :Parameters: None
+               :return: A ``dict``.
+             )pbdoc")
+        .def("run",
+             &fpsemigroup::KnuthBendix::run,
+             py::call_guard<py::gil_scoped_release>(),
+             runner_doc_strings::run)
         .def("kill", &fpsemigroup::KnuthBendix::kill, runner_doc_strings::kill)
         .def("dead", &fpsemigroup::KnuthBendix::dead, runner_doc_strings::dead)
         .def("finished",
@@ -621,9 +827,15 @@ namespace libsemigroups {
 
                :return: A string.
              )pbdoc")
-        .def("check_confluence_interval",
-             &fpsemigroup::KnuthBendix::check_confluence_interval,
-             py::arg("val"),
+        .def(
+            "check_confluence_interval",
+            [](py::object const& self, size_t val) {
+              auto& kb = self.cast<fpsemigroup::KnuthBendix&>();
+              kb.check_confluence_interval(val);
+              recorded_settings(self)["check_confluence_interval"] = val;
+              return self;
+            },
+            py::arg("val"),
              R"pbdoc(
               Set the interval at which confluence is checked.
 
@@ -632,9 +844,15 @@ namespace libsemigroups {
 
               :return: ``self``.
             )pbdoc")
-        .def("overlap_policy",
-             &fpsemigroup::KnuthBendix::overlap_policy,
-             py::arg("val"),
+        .def(
+            "overlap_policy",
+            [](py::object const&                         self,
+               fpsemigroup::KnuthBendix::options::overlap val) {
+              self.cast<fpsemigroup::KnuthBendix&>().overlap_policy(val);
+              recorded_settings(self)["overlap_policy"] = val;
+              return self;
+            },
+            py::arg("val"),
              R"pbdoc(
                Set the overlap policy.
 
@@ -643,9 +861,14 @@ namespace libsemigroups {
 
                :return: ``self``.
             )pbdoc")
-        .def("max_overlap",
-             &fpsemigroup::KnuthBendix::max_overlap,
-             py::arg("val"),
+        .def(
+            "max_overlap",
+            [](py::object const& self, size_t val) {
+              self.cast<fpsemigroup::KnuthBendix&>().max_overlap(val);
+              recorded_settings(self)["max_overlap"] = val;
+              return self;
+            },
+            py::arg("val"),
              R"pbdoc(
                Set the maximum length of overlaps to be considered.
 
@@ -654,9 +877,14 @@ namespace libsemigroups {
 
                :return: ``self``.
              )pbdoc")
-        .def("max_rules",
-             &fpsemigroup::KnuthBendix::max_rules,
-             py::arg("val"),
+        .def(
+            "max_rules",
+            [](py::object const& self, size_t val) {
+              self.cast<fpsemigroup::KnuthBendix&>().max_rules(val);
+              recorded_settings(self)["max_rules"] = val;
+              return self;
+            },
+            py::arg("val"),
              R"pbdoc(
                Set the maximum number of rules.
 
@@ -667,6 +895,7 @@ namespace libsemigroups {
              )pbdoc")
         .def("knuth_bendix_by_overlap_length",
              &fpsemigroup::KnuthBendix::knuth_bendix_by_overlap_length,
+             py::call_guard<py::gil_scoped_release>(),
              R"pbdoc(
                Run the Knuth-Bendix algorithm by overlap length.
 
@@ -782,6 +1011,121 @@ namespace libsemigroups {
                :type w: str
 
                :returns: A copy of the argument ``w`` after it has been rewritten.
-             )pbdoc");
+             )pbdoc")
+        .def(
+            "normal_form_many",
+            [](fpsemigroup::KnuthBendix&       kb,
+               std::vector<std::string> const& words,
+               size_t                          max_threads) {
+              return rewrite_strings(kb, words, max_threads, true);
+            },
+            py::arg("words"),
+            py::arg("max_threads") = 1,
+            R"pbdoc(
+              Returns the normal forms of many words.
+
+              This function runs this to completion, and then returns a list
+              containing the normal form of every word in ``words``; it is
+              equivalent to, but much faster than, calling
+              :py:meth:`normal_form` on each word.
+
+              The words are processed in C++ with the GIL released, and split
+              between (at most) ``max_threads`` threads, which share the
+              rules of this, and so the rules must not be modified (for
+              example, by running this in another thread) while this
+              function is running.
+
+              The words can be given as a list of ``str``, as a list of
+              ``List[int]``, or as two 1-dimensional arrays ``offsets`` and
+              ``letters`` such that the ``i``-th word is
+              ``letters[offsets[i]:offsets[i + 1]]``. In the last case, the
+              return value is a tuple ``(offsets, letters)`` of
+              ``numpy.ndarray`` in the same format.
+
+              :Parameters: - **words** (List[str]) - the words.
+                           - **max_threads** (int) - the maximum number of
+                             threads to use, ``0`` means as many as the
+                             hardware supports (defaults to ``1``).
+
+              :Returns: A ``List[str]``.
+            )pbdoc")
+        .def(
+            "normal_form_many",
+            [](fpsemigroup::KnuthBendix&     kb,
+               std::vector<word_type> const& words,
+               size_t                        max_threads) {
+              return rewrite_words(kb, words, max_threads, true);
+            },
+            py::arg("words"),
+            py::arg("max_threads") = 1)
+        .def(
+            "normal_form_many",
+            [](fpsemigroup::KnuthBendix& kb,
+               py::object const&         offsets,
+               py::object const&         letters,
+               size_t                    max_threads) {
+              return rewrite_flat(kb, offsets, letters, max_threads, true);
+            },
+            py::arg("offsets"),
+            py::arg("letters"),
+            py::arg("max_threads") = 1)
+        .def(
+            "rewrite_many",
+            [](fpsemigroup::KnuthBendix&       kb,
+               std::vector<std::string> const& words,
+               size_t                          max_threads) {
+              return rewrite_strings(kb, words, max_threads, false);
+            },
+            py::arg("words"),
+            py::arg("max_threads") = 1,
+            R"pbdoc(
+              Rewrite many words.
+
+              This function returns a list containing a copy of every word in
+              ``words`` rewritten according to the current rules of this; it
+              is equivalent to, but much faster than, calling
+              :py:meth:`rewrite` on each word. If this is confluent, then
+              this is the same as :py:meth:`normal_form_many`.
+
+              The words are processed in C++ with the GIL released, and split
+              between (at most) ``max_threads`` threads, which share the
+              rules of this, and so the rules must not be modified (for
+              example, by running this in another thread) while this
+              function is running.
+
+              The words can be given as a list of ``str``, as a list of
+              ``List[int]``, or as two 1-dimensional arrays ``offsets`` and
+              ``letters`` such that the ``i``-th word is
+              ``letters[offsets[i]:offsets[i + 1]]``. In the last case, the
+              return value is a tuple ``(offsets, letters)`` of
+              ``numpy.ndarray`` in the same format.
+
+              :Parameters: - **words** (List[str]) - the words.
+                           - **max_threads** (int) - the maximum number of
+                             threads to use, ``0`` means as many as the
+                             hardware supports (defaults to ``1``).
+
+              :Returns: A ``List[str]``.
+            )pbdoc")
+        .def(
+            "rewrite_many",
+            [](fpsemigroup::KnuthBendix&     kb,
+               std::vector<word_type> const& words,
+               size_t                        max_threads) {
+              return rewrite_words(kb, words, max_threads, false);
+            },
+            py::arg("words"),
+            py::arg("max_threads") = 1)
+        .def(
+            "rewrite_many",
+            [](fpsemigroup::KnuthBendix& kb,
+               py::object const&         offsets,
+               py::object const&         letters,
+               size_t                    max_threads) {
+              return rewrite_flat(kb, offsets, letters, max_threads, false);
+            },
+            py::arg("offsets"),
+            py::arg("letters"),
+            py::arg("max_threads") = 1);
   }  // namespace
 }  // namespace libsemigroups
@@ -17,7 +17,15 @@
 //
 
 // C std headers....
+#include <stddef.h>  // for size_t
+#include <stdint.h>  // for uint8_t
+
 // C++ stl headers....
+#include <string>         // for string
+#include <unordered_map>  // for unordered_map
+#include <utility>        // for move
+#include <vector>         // for vector
+
 // libsemigroups....
 #include <libsemigroups/bmat.hpp>       // for ImageRightAction
 #include <libsemigroups/bmat8.hpp>      // for BMat8
@@ -32,11 +40,78 @@
 #include <pybind11/stl.h>
 
 // libsemigroups_pybind11....
-#include "main.hpp"  // for init_konieczny
+#include "elements.hpp"  // for LIBSEMIGROUPS_PYBIND11_ENABLE_TRANSF16, ...
+#include "main.hpp"      // for init_konieczny
+#include "numpy.hpp"     // for to_array
+#include "runner.hpp"    // for run_until, run_until_cancelled
 
 namespace py = pybind11;
 
 namespace libsemigroups {
+  namespace {
+    // Returns a dict of 1-dimensional NumPy arrays, each containing one
+    // entry per D-class of k (in the order of k.cbegin_D_classes()).
+    template <typename T>
+    py::dict green_structure(T& k) {
+      std::vector<size_t>  size, nr_L, nr_R, size_H, nr_idem;
+      std::vector<uint8_t> regular;
+      {
+        py::gil_scoped_release release;
+        k.run();
+        size_t const n = k.number_of_D_classes();
+        for (auto* v : {&size, &nr_L, &nr_R, &size_H, &nr_idem}) {
+          v->reserve(n);
+        }
+        regular.reserve(n);
+        for (auto it = k.cbegin_D_classes(); it != k.cend_D_classes(); ++it) {
+          auto const& D = *it;
+          size.push_back(D.size());
+          nr_L.push_back(D.number_of_L_classes());
+          nr_R.push_back(D.number_of_R_classes());
+          size_H.push_back(D.size_H_class());
+          nr_idem.push_back(D.number_of_idempotents());
+          regular.push_back(D.is_regular_D_class());
+        }
+      }
+      std::vector<size_t> nr_H(size.size());
+      for (size_t i = 0; i < nr_H.size(); ++i) {
+        nr_H[i] = nr_L[i] * nr_R[i];
+      }
+      using libsemigroups_pybind11::to_array;
+      py::dict result;
+      result["size"]                  = to_array(std::move(size));
+      result["number_of_L_classes"]   = to_array(std::move(nr_L));
+      result["number_of_R_classes"]   = to_array(std::move(nr_R));
+      result["number_of_H_classes"]   = to_array(std::move(nr_H));
+      result["size_H_class"]          = to_array(std::move(size_H));
+      result["number_of_idempotents"] = to_array(std::move(nr_idem));
+      result["is_regular"]
+          = to_array(std::move(regular)).attr("astype")("bool");
+      return result;
+    }
+
+    // Returns the index (in the order of k.cbegin_D_classes()) of the
+    // D-class of each element of coll.
+    template <typename T>
+    py::array_t<size_t>
+    D_class_indices(T& k, std::vector<typename T::element_type> const& coll) {
+      std::vector<size_t> result;
+      {
+        py::gil_scoped_release release;
+        k.run();
+        std::unordered_map<typename T::DClass const*, size_t> index;
+        size_t                                                i = 0;
+        for (auto it = k.cbegin_D_classes(); it != k.cend_D_classes(); ++it) {
+          index.emplace(&*it, i++);
+        }
+        result.reserve(coll.size());
+        for (auto const& x : coll) {
+          result.push_back(index.at(&k.D_class_of_element(x)));
+        }
+      }
+      return libsemigroups_pybind11::to_array(std::move(result));
+    }
+  }  // namespace
 
   template <typename T, typename S = KoniecznyTraits<T>>
   void bind_konieczny(py::module& m, std::string typestr) {
@@ -69,6 +144,10 @@ namespace libsemigroups {
                return py::make_iterator(k.cbegin_regular_D_classes(),
                                         k.cend_regular_D_classes());
              })
+        .def("green_structure", &green_structure<Konieczny_>)
+        .def("D_class_indices",
+             &D_class_indices<Konieczny_>,
+             py::arg("coll"))
         .def("number_of_D_classes", &Konieczny_::number_of_D_classes)
         .def("number_of_L_classes", &Konieczny_::number_of_L_classes)
         .def("number_of_R_classes", &Konieczny_::number_of_R_classes)
@@ -117,11 +196,17 @@ namespace libsemigroups {
         .def("running", &Konieczny_::running)
         .def("stopped_by_predicate", &Konieczny_::stopped_by_predicate)
         .def("kill", &Konieczny_::kill)
-        .def("run", &Konieczny_::run)
+        .def("run", &Konieczny_::run, py::call_guard<py::gil_scoped_release>())
         .def("run_for",
-             (void(Konieczny_::*)(std::chrono::nanoseconds)) & Runner::run_for)
+             (void(Konieczny_::*)(std::chrono::nanoseconds)) & Runner::run_for,
+             py::call_guard<py::gil_scoped_release>())
+        .def("run_until",
+             &libsemigroups_pybind11::run_until<Konieczny_>,
+             py::arg("func"),
+             py::arg("poll") = std::chrono::nanoseconds(0))
         .def("run_until",
-             (void(Konieczny_::*)(std::function<bool()>&)) & Runner::run_until)
+             &libsemigroups_pybind11::run_until_cancelled<Konieczny_>,
+             py::arg("token"))
         .def("report_every",
              (void(Konieczny_::*)(std::chrono::nanoseconds))
                  & Runner::report_every)
@@ -192,15 +277,35 @@ namespace libsemigroups {
   }
 
   void init_konieczny(py::module& m) {
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_TRANSF16
     bind_konieczny<LeastTransf<16>>(m, "Transf16");
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_TRANSF1
     bind_konieczny<Transf<0, uint8_t>>(m, "Transf1");
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_TRANSF2
     bind_konieczny<Transf<0, uint16_t>>(m, "Transf2");
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_TRANSF4
     bind_konieczny<Transf<0, uint32_t>>(m, "Transf4");
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_PPERM16
     bind_konieczny<LeastPPerm<16>>(m, "PPerm16");
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_PPERM1
     bind_konieczny<PPerm<0, uint8_t>>(m, "PPerm1");
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_PPERM2
     bind_konieczny<PPerm<0, uint16_t>>(m, "PPerm2");
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_PPERM4
     bind_konieczny<PPerm<0, uint32_t>>(m, "PPerm4");
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_BMAT8
     bind_konieczny<BMat8>(m, "BMat8");
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_BMAT
     bind_konieczny<BMat<>>(m, "BMat");
+#endif
   }
 }  // namespace libsemigroups
@@ -20,13 +20,19 @@
 
 // C std headers....
 #include <stddef.h>  // for size_t
+#include <stdlib.h>  // for getenv
 
 // C++ stl headers....
+#include <array>             // for array
 #include <initializer_list>  // for initializer_list
+#include <string>            // for string
+#include <unordered_map>     // for unordered_map
+#include <vector>            // for vector
 
 // libsemigroups....
 #include <libsemigroups/cong-intf.hpp>  // for congruence_kind, congruence_kind:...
 #include <libsemigroups/constants.hpp>  // for PositiveInfinity, Undefined, POSI...
+#include <libsemigroups/exception.hpp>  // for LIBSEMIGROUPS_EXCEPTION
 #include <libsemigroups/kbe.hpp>        // for KBE, operator<<
 #include <libsemigroups/report.hpp>     // for ReportGuard
 #include <libsemigroups/string.hpp>     // for to_string
@@ -36,10 +42,182 @@
 // pybind11....
 #include <pybind11/operators.h>  // for self, operator<, operator==, self_t
 #include <pybind11/pybind11.h>   // for module_, class_, enum_, init
+#include <pybind11/stl.h>        // for conversion of C++ to py types
+
+// libsemigroups_pybind11....
+#include "cancellation.hpp"  // for CancellationToken
+#include "elements.hpp"      // for enabled_elements, ...
 
 namespace py = pybind11;
 
 namespace libsemigroups {
+  namespace {
+    // The bindings are divided into subsystems, which are bound when they
+    // are first used, rather than when the module is imported. Each
+    // subsystem only uses the types in the subsystems before it, which are
+    // bound first, so that the signatures in the doc strings contain the
+    // Python names of these types.
+    struct Subsystem {
+      char const* name;
+      void (*init)(py::module&);
+      bool loaded;
+    };
+
+    void init_digraphs(py::module& m) {
+      init_action_digraph(m);
+      init_forest(m);
+      init_words(m);
+    }
+
+    void init_elements(py::module& m) {
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_BIPARTITION
+      init_bipart(m);
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_BMAT8
+      init_bmat8(m);
+#endif
+      init_matrix(m);
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_PBR
+      init_pbr(m);
+#endif
+      init_transf(m);
+    }
+
+    void init_semigroups(py::module& m) {
+      init_froidure_pin(m);
+      init_konieczny(m);
+    }
+
+    void init_congruences(py::module& m) {
+      init_cong(m);
+      init_fpsemi_examples(m);
+      init_fpsemi(m);
+      init_kambites(m);
+      init_knuth_bendix(m);
+      init_present(m);
+      init_race(m);
+      init_sims1(m);
+      init_stephen(m);
+      init_todd_coxeter(m);
+      init_ukkonen(m);
+    }
+
+    std::array<Subsystem, 4>& subsystems() {
+      static std::array<Subsystem, 4> result
+          = {{{"digraphs", &init_digraphs, false},
+              {"elements", &init_elements, false},
+              {"froidure_pin", &init_semigroups, false},
+              {"congruences", &init_congruences, false}}};
+      return result;
+    }
+
+    // Returns the subsystem that binds the module attribute called name, or
+    // nullptr if no subsystem does. The names bound by each subsystem are
+    // listed explicitly (a name bound by several subsystems, such as make,
+    // is listed with the last of them), except for the FroidurePin and
+    // Konieczny classes, whose names depend on the enabled element types. A
+    // name missing from the table is still found by __getattr__ below, but
+    // only after every subsystem has been loaded.
+    Subsystem* subsystem_of(std::string const& name) {
+      static std::unordered_map<std::string, size_t> const index = [] {
+        std::array<std::vector<char const*>, 4> const names = {{
+              // digraphs
+              {"ActionDigraph", "Forest", "PaniloChunks", "PanisloChunks",
+               "PiloChunks", "PisloChunks", "PstiloChunks", "PstisloChunks",
+               "SiloChunks", "SisloChunks", "WiloChunks", "WisloChunks",
+               "Word", "add_cycle", "follow_path", "is_acyclic",
+               "number_of_words", "silo", "silo_chunks", "sislo",
+               "sislo_chunks", "topological_sort", "wilo", "wilo_chunks",
+               "wilo_split", "wislo", "wislo_chunks", "wislo_split"},
+              // elements
+              {"BMat", "BMat8", "Bipartition", "IntMat", "MaxPlusMat",
+               "MaxPlusTruncMat", "MaxPlusTruncSemiring", "MinPlusMat",
+               "MinPlusTruncMat", "MinPlusTruncSemiring", "NTPMat",
+               "NTPSemiring", "PBR", "PPerm1", "PPerm16", "PPerm2", "PPerm4",
+               "Perm1", "Perm16", "Perm2", "Perm4", "ProjMaxPlusMat",
+               "Transf1", "Transf16", "Transf2", "Transf4"},
+              // froidure_pin
+              {"FroidurePinBase"},
+              // congruences
+              {"Congruence", "FpSemigroup", "Kambites", "KnuthBendix",
+               "MinimalRepOrc", "PresentationStrings",
+               "PresentationStringsRulesView", "PresentationWords",
+               "PresentationWordsRulesView", "Race", "RepOrc", "Sims1",
+               "Sims1Batches", "Sims1Stats",
+               "Stephen", "ToddCoxeter", "Ukkonen", "_dot", "accepts",
+               "accepts_many", "add_identity_rules", "add_inverse_rules",
+               "add_rule", "add_rule_and_check", "add_rules", "add_words",
+               "add_words_no_checks", "add_zero_rules", "alternating_group",
+               "are_rules_sorted", "author", "brauer_monoid",
+               "change_alphabet", "character", "chinese_monoid",
+               "dual_symmetric_inverse_monoid", "fibonacci_semigroup",
+               "first_unused_letter", "full_transformation_monoid",
+               "greedy_reduce_length", "is_left_factor", "is_left_factor_many",
+               "is_piece", "is_piece_many", "is_piece_many_no_checks",
+               "is_piece_no_checks", "is_strongly_compressible", "is_subword",
+               "is_subword_many", "is_subword_many_no_checks",
+               "is_subword_no_checks", "is_suffix", "is_suffix_many",
+               "is_suffix_many_no_checks", "is_suffix_no_checks",
+               "left_factors", "left_factors_chunks", "length", "letter",
+               "longest_common_subword", "longest_rule", "longest_rule_length",
+               "make", "make_presentation", "make_semigroup",
+               "maximal_piece_prefix", "maximal_piece_prefix_lengths",
+               "maximal_piece_prefix_lengths_no_checks",
+               "maximal_piece_prefix_no_checks", "maximal_piece_suffix",
+               "maximal_piece_suffix_lengths",
+               "maximal_piece_suffix_lengths_no_checks",
+               "maximal_piece_suffix_no_checks", "monogenic_semigroup",
+               "normalize_alphabet", "number_of_distinct_subwords",
+               "number_of_left_factors", "number_of_pieces",
+               "number_of_pieces_many", "number_of_pieces_many_no_checks",
+               "number_of_pieces_no_checks", "number_of_words_accepted",
+               "orientation_preserving_monoid", "orientation_reversing_monoid",
+               "partial_transformation_monoid", "partition_monoid", "pieces",
+               "pieces_no_checks", "plactic_monoid", "read_presentation",
+               "rectangular_band", "reduce_complements",
+               "reduce_to_2_generators", "redundant_rule_strings",
+               "redundant_rule_words", "remove_duplicate_rules",
+               "remove_redundant_generators", "remove_trivial_rules",
+               "replace_subword", "replace_word", "reverse", "shortest_rule",
+               "shortest_rule_length", "simplify", "singular_brauer_monoid",
+               "sort_each_rule", "sort_rules", "stellar_monoid",
+               "strongly_compress", "stylic_monoid", "symmetric_group",
+               "symmetric_inverse_monoid", "temperley_lieb_monoid",
+               "uniform_block_bijection_monoid", "words_accepted",
+               "words_accepted_chunks", "write_presentation"}}};
+        std::unordered_map<std::string, size_t> result;
+        for (size_t i = 0; i < names.size(); ++i) {
+          for (auto const* n : names[i]) {
+            result.emplace(n, i);
+          }
+        }
+        return result;
+      }();
+      auto it = index.find(name);
+      if (it != index.cend()) {
+        return &subsystems()[it->second];
+      } else if (name.compare(0, 11, "FroidurePin") == 0
+                 || name.compare(0, 9, "Konieczny") == 0) {
+        return &subsystems()[2];
+      }
+      return nullptr;
+    }
+
+    // Binds the subsystem s, and every subsystem before it, if they are not
+    // already bound. A subsystem is only marked as loaded once it has been
+    // bound successfully.
+    void load_subsystem(py::module& m, Subsystem& s) {
+      for (auto& t : subsystems()) {
+        if (!t.loaded) {
+          t.init(m);
+          t.loaded = true;
+        }
+        if (&t == &s) {
+          return;
+        }
+      }
+    }
+  }  // namespace
 
   PYBIND11_MODULE(_libsemigroups_pybind11, m) {
     ////////////////////////////////////////////////////////////////////////
@@ -76,6 +254,106 @@ namespace libsemigroups {
      :type val: bool
     )pbdoc");
 
+    using libsemigroups_pybind11::CancellationToken;
+
+    py::class_<CancellationToken>(m,
+                                  "CancellationToken",
+                                  R"pbdoc(
+      Objects of this type can be used to stop any number of algorithms, such
+      as :py:class:`ToddCoxeter`, :py:class:`KnuthBendix`, or
+      :py:class:`Congruence`, running in any number of threads, at once.
+
+      An algorithm is stopped by a token when it is run using
+      ``run_until(token)``, and ``token`` is cancelled, or it is finished.
+      Checking if a token is cancelled does not require the GIL, and so is
+      much cheaper than using a Python function in ``run_until``. Copies of a
+      token are cancelled together.
+    )pbdoc")
+        .def(py::init<>(),
+             R"pbdoc(
+               Constructs a :py:class:`CancellationToken` that is not
+               cancelled.
+             )pbdoc")
+        .def("__copy__",
+             [](CancellationToken const& t) { return CancellationToken(t); })
+        .def("cancel",
+             &CancellationToken::cancel,
+             py::call_guard<py::gil_scoped_release>(),
+             R"pbdoc(
+               Cancel the token, and so stop every algorithm running until
+               this token is cancelled.
+
+               This function is thread-safe.
+
+               :Parameters: None
+               :return: None
+             )pbdoc")
+        .def("reset",
+             &CancellationToken::reset,
+             R"pbdoc(
+               Reset the token, so that it is no longer cancelled.
+
+               :Parameters: None
+               :return: None
+             )pbdoc")
+        .def("cancelled",
+             &CancellationToken::cancelled,
+             R"pbdoc(
+               Check if the token has been cancelled.
+
+               :Parameters: None
+               :return: A ``bool``.
+             )pbdoc")
+        .def(
+            "cancel_on_signal",
+            [](CancellationToken const& token, py::object signum) {
+              py::module_ signal   = py::module_::import("signal");
+              py::object  previous = signal.attr("getsignal")(signum);
+              signal.attr("signal")(
+                  signum,
+                  py::cpp_function([token](py::args) mutable {
+                    token.cancel();
+                  }));
+              return previous;
+            },
+            py::arg("signum"),
+            R"pbdoc(
+              Cancel the token whenever a signal is received.
+
+              This installs a handler for the signal ``signum``, using
+              :py:func:`signal.signal`, that cancels this token (and does
+              nothing else), in place of the previous handler, which is
+              returned. The previous handler can be restored by calling
+              ``signal.signal(signum, previous)``; for example:
+
+              .. code-block:: python
+
+                 previous = token.cancel_on_signal(signal.SIGINT)
+                 try:
+                     tc.run_until(token)
+                 finally:
+                     signal.signal(signal.SIGINT, previous)
+
+              As for any handler installed using :py:mod:`signal`, the
+              handler runs in the main thread. An algorithm that is running
+              in the main thread using ``run_until(token)`` checks for
+              signals regularly, and so is stopped when the signal is
+              received, as is any algorithm running in another thread
+              using ``run_until`` with this token (or a copy of it).
+              Similarly, while the handler for ``SIGINT`` is the default one,
+              a :py:exc:`KeyboardInterrupt` stops an algorithm running in the
+              main thread using ``run_until(token)``, and is then re-raised.
+
+              :param signum: the signal number, such as ``signal.SIGINT``.
+              :type signum: int
+
+              :return: The previous handler for ``signum``.
+
+              :raises ValueError:
+                if ``signum`` is not a valid signal number, or if this is
+                not called in the main thread.
+            )pbdoc");
+
     ////////////////////////////////////////////////////////////////////////
     // Constants
     ////////////////////////////////////////////////////////////////////////
@@ -240,31 +518,68 @@ namespace libsemigroups {
         .def(pybind11::self < pybind11::self);
 
     ////////////////////////////////////////////////////////////////////////
-    // Init
+    // Subsystems
     ////////////////////////////////////////////////////////////////////////
 
-    init_action_digraph(m);
-    init_bipart(m);
-    init_bmat8(m);
-    init_cong(m);
-    init_forest(m);
-    init_fpsemi_examples(m);
-    init_fpsemi(m);
-    init_kambites(m);
-    init_knuth_bendix(m);
-    init_matrix(m);
-    init_pbr(m);
-    init_present(m);
-    init_sims1(m);
-    init_stephen(m);
-    init_todd_coxeter(m);
-    init_transf(m);
-    init_ukkonen(m);
-    init_words(m);
-
-    // Must come last
-    init_froidure_pin(m);
-    init_konieczny(m);
+    m.attr("_enabled_elements")
+        = py::tuple(py::cast(libsemigroups_pybind11::enabled_elements()));
+
+    m.def(
+        "_load_subsystem",
+        [](std::string const& name) {
+          py::module_ self = py::module_::import("_libsemigroups_pybind11");
+          for (auto& s : subsystems()) {
+            if (name == s.name) {
+              load_subsystem(self, s);
+              return;
+            }
+          }
+          LIBSEMIGROUPS_EXCEPTION("unknown subsystem \"%s\"", name.c_str());
+        },
+        py::arg("name"));
+
+    m.def("_loaded_subsystems", []() {
+      py::list result;
+      for (auto const& s : subsystems()) {
+        if (s.loaded) {
+          result.append(s.name);
+        }
+      }
+      return result;
+    });
+
+    // Called by Python when a name is not found in the module (PEP 562),
+    // loads the subsystem binding the name, if any, see subsystem_of. If the
+    // name is not bound by that subsystem (for example, because it is missing
+    // from the table in subsystem_of), then every remaining subsystem is
+    // loaded before giving up. Dunder names, which Python probes for when
+    // importing, never load anything.
+    m.def("__getattr__", [](std::string const& name) -> py::object {
+      if (name.compare(0, 2, "__") != 0) {
+        py::module_ self = py::module_::import("_libsemigroups_pybind11");
+        // Using hasattr here would call this function again.
+        py::dict   dict = self.attr("__dict__");
+        Subsystem* s    = subsystem_of(name);
+        if (s != nullptr && !s->loaded) {
+          load_subsystem(self, *s);
+        }
+        if (!dict.contains(name) && !subsystems().back().loaded) {
+          load_subsystem(self, subsystems().back());
+        }
+        if (dict.contains(name)) {
+          return dict[name.c_str()];
+        }
+      }
+      throw py::attribute_error("module '_libsemigroups_pybind11' has no "
+                                "attribute '"
+                                + name + "'");
+    });
+
+    if (::getenv("LIBSEMIGROUPS_PYBIND11_EAGER") != nullptr) {
+      for (auto& s : subsystems()) {
+        load_subsystem(m, s);
+      }
+    }
 
 #ifdef VERSION_INFO
     m.attr("__version__") = VERSION_INFO;
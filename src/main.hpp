@@ -21,6 +21,8 @@
 
 #include <pybind11/pybind11.h>
 
+#include "word.hpp"
+
 namespace libsemigroups {
   namespace py = pybind11;
 
@@ -38,6 +40,7 @@ namespace libsemigroups {
   void init_matrix(py::module&);
   void init_pbr(py::module&);
   void init_present(py::module&);
+  void init_race(py::module&);
   void init_sims1(py::module&);
   void init_stephen(py::module&);
   void init_todd_coxeter(py::module&);
@@ -20,11 +20,13 @@
 #include <stdint.h>  // for uint64_t
 
 // C++ stl headers....
-#include <algorithm>         // for replace
+#include <algorithm>         // for copy, replace
 #include <cstddef>           // for size_t
+#include <functional>        // for hash
 #include <initializer_list>  // for initializer_list
 #include <iosfwd>            // for string
 #include <memory>            // for allocator, make_unique, unique_ptr
+#include <mutex>             // for mutex, lock_guard
 #include <regex>             // for regex_replace
 #include <string>            // for char_traits, operator==, operator+
 #include <unordered_map>     // for operator==, unordered_map
@@ -32,17 +34,21 @@
 #include <vector>            // for vector
 
 // libsemigroups....
-#include <libsemigroups/adapters.hpp>  // for Hash
-#include <libsemigroups/matrix.hpp>    // for MaxPlusTruncMat, MinPlusTruncMat
-#include <libsemigroups/string.hpp>    // for string_format, to_string
+#include <libsemigroups/adapters.hpp>   // for Hash
+#include <libsemigroups/exception.hpp>  // for LIBSEMIGROUPS_EXCEPTION
+#include <libsemigroups/matrix.hpp>     // for MaxPlusTruncMat, MinPlusTruncMat
+#include <libsemigroups/string.hpp>     // for string_format, to_string
 
 // pybind11....
+#include <pybind11/numpy.h>      // for array_t
 #include <pybind11/operators.h>  // for self, self_t, operator!=, operator*
 #include <pybind11/pybind11.h>   // for init, class_, module
 #include <pybind11/stl.h>
 
 // libsemigroups_pybind11....
-#include "main.hpp"  // for init_matrix
+#include "elements.hpp"  // for LIBSEMIGROUPS_PYBIND11_ENABLE_BMAT, ...
+#include "main.hpp"      // for init_matrix
+#include "numpy.hpp"     // for input_array, integer_array, ...
 
 // TODO(later):
 // 1) RowViews
@@ -66,10 +72,20 @@ namespace libsemigroups {
         return result;
       }
 
+      // The semiring registry: semiring<T>(threshold) and
+      // semiring<T>(threshold, period) return a pointer to the unique
+      // semiring of type T with the given parameters, which is constructed
+      // the first time that it is requested. These can be called from any
+      // thread, with or without the GIL. The semirings are never destroyed,
+      // since every matrix over a semiring holds a raw pointer to it, and so
+      // the registry contains one semiring for every distinct set of
+      // parameters ever used.
       template <typename T>
       T const* semiring(size_t threshold) {
+        static std::mutex mtx;
         static std::unordered_map<size_t, std::unique_ptr<T const>> cache;
-        auto it = cache.find(threshold);
+        std::lock_guard<std::mutex> lock(mtx);
+        auto                        it = cache.find(threshold);
         if (it == cache.end()) {
           it = cache.emplace(threshold, std::make_unique<T const>(threshold))
                    .first;
@@ -79,12 +95,14 @@ namespace libsemigroups {
 
       template <typename T>
       T const* semiring(size_t threshold, size_t period) {
+        static std::mutex mtx;
         static std::unordered_map<std::pair<size_t, size_t>,
                                   std::unique_ptr<T const>,
                                   Hash<std::pair<size_t, size_t>>>
-             cache;
-        auto tp = std::make_pair(threshold, period);
-        auto it = cache.find(tp);
+                                    cache;
+        std::lock_guard<std::mutex> lock(mtx);
+        auto                        tp = std::make_pair(threshold, period);
+        auto                        it = cache.find(tp);
         if (it == cache.end()) {
           it = cache.emplace(tp, std::make_unique<T const>(threshold, period))
                    .first;
@@ -92,6 +110,158 @@ namespace libsemigroups {
         return it->second.get();
       }
 
+      // Semirings are bound with a holder that never deletes them, and the
+      // only way to construct one from Python is to look it up in the
+      // registry, so that a semiring always outlives the matrices over it.
+      template <typename S>
+      using semiring_class = py::class_<S, std::unique_ptr<S, py::nodelete>>;
+
+      template <typename S>
+      semiring_class<S> bind_semiring(py::module& m, std::string const& name) {
+        semiring_class<S> x(m, name.c_str());
+        x.def("threshold", [](S const& sr) { return sr.threshold(); })
+            .def("__eq__",
+                 [](S const& sr, S const& that) { return &sr == &that; })
+            .def("__hash__",
+                 [](S const& sr) { return std::hash<S const*>()(&sr); });
+        return x;
+      }
+
+      template <typename T>
+      using entries_array
+          = libsemigroups_pybind11::input_array<typename T::scalar_type>;
+
+      // Returns the entries of the array-like object obj as an entries_array.
+      // The entries of obj must be integers or bools that scalar_type can
+      // represent, so that floats, which would otherwise be silently
+      // truncated, and out of range integers, which would otherwise be
+      // silently wrapped, are rejected (see integer_array).
+      template <typename T>
+      entries_array<T> integer_entries(py::object const& obj) {
+        return libsemigroups_pybind11::integer_array<typename T::scalar_type>(
+            obj);
+      }
+
+      // Returns the rows of the nr_rows x nr_cols matrix whose entries, in
+      // row-major order, start at first.
+      template <typename S>
+      std::vector<std::vector<S>> entries_to_rows(S const* first,
+                                                  size_t   nr_rows,
+                                                  size_t   nr_cols) {
+        std::vector<std::vector<S>> rows;
+        rows.reserve(nr_rows);
+        for (size_t i = 0; i < nr_rows; ++i) {
+          rows.emplace_back(first + i * nr_cols, first + (i + 1) * nr_cols);
+        }
+        return rows;
+      }
+
+      // Returns the matrix whose entries are given in the 2-dimensional
+      // array a, where make(rows) returns the matrix with the given rows.
+      template <typename T, typename Make>
+      T matrix_from_array(py::array const& a, Make&& make) {
+        auto entries = integer_entries<T>(a);
+        if (entries.ndim() != 2) {
+          LIBSEMIGROUPS_EXCEPTION("expected a 2-dimensional array, found %lld "
+                                  "dimensions",
+                                  static_cast<long long>(entries.ndim()));
+        }
+        return make(entries_to_rows(
+            entries.data(), entries.shape(0), entries.shape(1)));
+      }
+
+      // Returns the list of the validated matrices whose entries are given in
+      // the 3-dimensional array a (one matrix per entry in the first
+      // dimension), see matrix_from_array. The matrices are constructed with
+      // the GIL released, and so make must not call into Python.
+      template <typename T, typename Make>
+      std::vector<T> matrices_from_array(entries_array<T> const& a,
+                                         Make&&                  make) {
+        if (a.ndim() != 3) {
+          LIBSEMIGROUPS_EXCEPTION("expected a 3-dimensional array, found %lld "
+                                  "dimensions",
+                                  static_cast<long long>(a.ndim()));
+        }
+        size_t const   n       = a.shape(0);
+        size_t const   nr_rows = a.shape(1);
+        size_t const   nr_cols = a.shape(2);
+        auto const*    first   = a.data();
+        std::vector<T> result;
+        py::gil_scoped_release release;
+        result.reserve(n);
+        for (size_t i = 0; i < n; ++i) {
+          result.push_back(make(entries_to_rows(
+              first + i * nr_rows * nr_cols, nr_rows, nr_cols)));
+          validate(result.back());
+        }
+        return result;
+      }
+
+      // Returns a NumPy array containing a copy of the entries of x. The array
+      // does not view the entries of x, since swap can move them to another
+      // matrix.
+      template <typename T>
+      py::array_t<typename T::scalar_type> matrix_to_array(T const& x) {
+        size_t const nr_rows = x.number_of_rows();
+        size_t const nr_cols = x.number_of_cols();
+        py::array_t<typename T::scalar_type> result({nr_rows, nr_cols});
+        std::copy(x.cbegin(), x.cend(), result.mutable_data());
+        return result;
+      }
+
+      // Returns the rows of x, which is used to pickle x.
+      template <typename T>
+      std::vector<std::vector<typename T::scalar_type>>
+      matrix_to_rows(T const& x) {
+        std::vector<std::vector<typename T::scalar_type>> rows(
+            x.number_of_rows());
+        for (size_t i = 0; i < rows.size(); ++i) {
+          for (size_t j = 0; j < x.number_of_cols(); ++j) {
+            rows[i].push_back(x(i, j));
+          }
+        }
+        return rows;
+      }
+
+      // Returns the array of the products of the square matrices whose
+      // entries are given in a and b, see batch_shape, where make(rows)
+      // returns the matrix with the given rows. The matrices in a and b are
+      // validated, and make must not call into Python.
+      template <typename T, typename Make>
+      py::array_t<typename T::scalar_type>
+      matrix_products(entries_array<T> const& a,
+                      entries_array<T> const& b,
+                      Make&&                  make) {
+        using scalar_type = typename T::scalar_type;
+        size_t n          = 0;
+        if (a.ndim() >= 2) {
+          n = a.shape(a.ndim() - 1);
+          if (static_cast<size_t>(a.shape(a.ndim() - 2)) != n) {
+            LIBSEMIGROUPS_EXCEPTION("the matrices must be square, found "
+                                    "%llu x %llu",
+                                    uint64_t(a.shape(a.ndim() - 2)),
+                                    uint64_t(n));
+          }
+        }
+        return libsemigroups_pybind11::batch_products<scalar_type>(
+            a,
+            b,
+            2,
+            [&make, n](scalar_type const* first) {
+              T result = make(entries_to_rows(first, n, n));
+              validate(result);
+              return result;
+            },
+            [](T& z, T const& x, T const& y) { z.product_inplace(x, y); },
+            [n](T const& z, scalar_type* first) {
+              for (size_t i = 0; i < n; ++i) {
+                for (size_t j = 0; j < n; ++j) {
+                  first[i * n + j] = z(i, j);
+                }
+              }
+            });
+      }
+
       template <typename T>
       auto bind_matrix_common(py::module& m, char const* type_name) {
         using Row         = typename T::Row;
@@ -139,7 +309,8 @@ namespace libsemigroups {
                 rs.push_back(Row(x.row(i)));
               }
               return rs;
-            });
+            })
+            .def("to_numpy", &matrix_to_array<T>);
 
         // TODO(later) no implemented in libsemigroups
         // x.def("__iadd__",
@@ -155,7 +326,16 @@ namespace libsemigroups {
         using scalar_type = typename T::scalar_type;
         auto x            = bind_matrix_common<T>(m, type_name);
 
-        x.def(py::init<std::vector<std::vector<scalar_type>> const&>())
+        auto make = [](std::vector<std::vector<scalar_type>> const& rows) {
+          return T(rows);
+        };
+
+        // This one has to come before the vector vector one, or else NumPy
+        // arrays are converted to lists of lists entry by entry.
+        x.def(py::init([make](py::array const& entries) {
+           return matrix_from_array<T>(entries, make);
+         }))
+            .def(py::init<std::vector<std::vector<scalar_type>> const&>())
             .def("__repr__",
                  [type_name](T const& x) -> std::string {
                    std::string str(type_name);
@@ -173,28 +353,153 @@ namespace libsemigroups {
             .def("__pow__", &matrix_helpers::pow<T>)
             .def_static("make_identity",
                         py::overload_cast<size_t>(&T::identity))
-            .def(py::init<size_t, size_t>());
+            .def_static(
+                "products",
+                [make](py::object const& a, py::object const& b) {
+                  return matrix_products<T>(
+                      integer_entries<T>(a), integer_entries<T>(b), make);
+                },
+                py::arg("a"),
+                py::arg("b"))
+            .def_static(
+                "make_many",
+                [make](py::object const& entries) {
+                  return matrices_from_array<T>(integer_entries<T>(entries),
+                                                make);
+                },
+                py::arg("entries"))
+            .def(py::init<size_t, size_t>())
+            .def(py::pickle(
+                [](T const& x) { return py::make_tuple(matrix_to_rows(x)); },
+                [make](py::tuple state) {
+                  return make(
+                      state[0]
+                          .cast<std::vector<std::vector<scalar_type>>>());
+                }));
+      }
+
+      // Adds the overloads of the constructors and static functions of the
+      // matrix type T, whose first argument is a semiring, rather than the
+      // threshold (and period) of a semiring, and the function returning the
+      // semiring of a matrix.
+      template <typename T>
+      void bind_matrix_semiring(py::class_<T>& x) {
+        using semiring_type = typename T::semiring_type;
+        using scalar_type   = typename T::scalar_type;
+        using rows_type     = std::vector<std::vector<scalar_type>>;
+
+        auto maker = [](semiring_type const& sr) {
+          auto const* ptr = &sr;
+          return [ptr](rows_type const& rows) { return T(ptr, rows); };
+        };
+
+        x.def_static(
+             "make",
+             [maker](semiring_type const& sr, py::array const& entries) {
+               auto result = matrix_from_array<T>(entries, maker(sr));
+               validate(result);
+               return result;
+             })
+            .def_static("make",
+                        [](semiring_type const& sr, rows_type const& entries) {
+                          auto result = T(&sr, entries);
+                          validate(result);
+                          return result;
+                        })
+            .def(py::init([](semiring_type const& sr, size_t r, size_t c) {
+              return T(&sr, r, c);
+            }))
+            .def(py::init(
+                [maker](semiring_type const& sr, py::array const& entries) {
+                  return matrix_from_array<T>(entries, maker(sr));
+                }))
+            .def(py::init(
+                [](semiring_type const& sr, rows_type const& entries) {
+                  return T(&sr, entries);
+                }))
+            .def_static("make_identity",
+                        [](semiring_type const& sr, size_t n) {
+                          return T::identity(&sr, n);
+                        })
+            .def_static(
+                "products",
+                [maker](semiring_type const& sr,
+                        py::object const&    a,
+                        py::object const&    b) {
+                  return matrix_products<T>(
+                      integer_entries<T>(a), integer_entries<T>(b), maker(sr));
+                },
+                py::arg("semiring"),
+                py::arg("a"),
+                py::arg("b"))
+            .def_static(
+                "make_many",
+                [maker](semiring_type const& sr, py::object const& entries) {
+                  return matrices_from_array<T>(integer_entries<T>(entries),
+                                                maker(sr));
+                },
+                py::arg("semiring"),
+                py::arg("entries"))
+            .def(
+                "semiring",
+                [](T const& x) { return x.semiring(); },
+                py::return_value_policy::reference);
       }
 
       template <typename T>
       auto bind_matrix_run(py::module& m, char const* type_name) {
         using semiring_type = typename T::semiring_type;
         using scalar_type   = typename T::scalar_type;
-        auto x              = bind_matrix_common<T>(m, type_name);
+
+        std::string name(type_name);
+        name.replace(name.size() - 3, 3, "Semiring");
+        bind_semiring<semiring_type>(m, name)
+            .def(py::init([](size_t threshold) {
+              // The semirings in the registry are const, but no non-const
+              // member functions of semirings are bound.
+              return const_cast<semiring_type*>(
+                  semiring<semiring_type>(threshold));
+            }))
+            .def("__repr__", [name](semiring_type const& sr) {
+              return string_format("%s(%llu)",
+                                   name.c_str(),
+                                   static_cast<uint64_t>(sr.threshold()));
+            });
+
+        auto x = bind_matrix_common<T>(m, type_name);
+
+        // Returns a function making a matrix from its rows, over the
+        // semiring with the given threshold.
+        auto maker = [](size_t threshold) {
+          auto const* sr = semiring<semiring_type>(threshold);
+          return [sr](std::vector<std::vector<scalar_type>> const& rows) {
+            return T(sr, rows);
+          };
+        };
 
         x.def_static("make",
-                     [](size_t                                       threshold,
-                        std::vector<std::vector<scalar_type>> const& entries) {
-                       // TODO(later) should be T::make but there's no make for
-                       // dynamic runtime matrices and vectors!
+                     [maker](size_t threshold, py::array const& entries) {
                        auto result
-                           = T(semiring<semiring_type>(threshold), entries);
+                           = matrix_from_array<T>(entries, maker(threshold));
                        validate(result);
                        return result;
                      })
+            .def_static(
+                "make",
+                [](size_t                                       threshold,
+                   std::vector<std::vector<scalar_type>> const& entries) {
+                  // TODO(later) should be T::make but there's no make for
+                  // dynamic runtime matrices and vectors!
+                  auto result = T(semiring<semiring_type>(threshold), entries);
+                  validate(result);
+                  return result;
+                })
             .def(py::init([](size_t threshold, size_t r, size_t c) {
               return T(semiring<semiring_type>(threshold), r, c);
             }))
+            .def(py::init([maker](size_t threshold, py::array const& entries) {
+              return matrix_from_array<T>(entries, maker(threshold));
+            }))
             .def(py::init(
                 [](size_t                                       threshold,
                    std::vector<std::vector<scalar_type>> const& entries) {
@@ -205,6 +510,26 @@ namespace libsemigroups {
                           return T::identity(semiring<semiring_type>(threshold),
                                              n);
                         })
+            .def_static(
+                "products",
+                [maker](size_t            threshold,
+                        py::object const& a,
+                        py::object const& b) {
+                  return matrix_products<T>(integer_entries<T>(a),
+                                            integer_entries<T>(b),
+                                            maker(threshold));
+                },
+                py::arg("threshold"),
+                py::arg("a"),
+                py::arg("b"))
+            .def_static(
+                "make_many",
+                [maker](size_t threshold, py::object const& entries) {
+                  return matrices_from_array<T>(integer_entries<T>(entries),
+                                                maker(threshold));
+                },
+                py::arg("threshold"),
+                py::arg("entries"))
             .def("__repr__", [type_name](T const& x) -> std::string {
               auto n = std::string(type_name).size();
               return string_format(
@@ -212,26 +537,75 @@ namespace libsemigroups {
                   std::string(type_name, type_name + n - 3).c_str(),
                   static_cast<uint64_t>(matrix_threshold(x)),
                   matrix_repr(x).c_str());
-            });
+            })
+            .def(py::pickle(
+                [](T const& x) {
+                  return py::make_tuple(
+                      static_cast<size_t>(matrix_threshold(x)),
+                      matrix_to_rows(x));
+                },
+                [maker](py::tuple state) {
+                  return maker(state[0].cast<size_t>())(
+                      state[1].cast<std::vector<std::vector<scalar_type>>>());
+                }));
+        bind_matrix_semiring(x);
       }
 
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_NTPMAT
       auto bind_ntp_matrix(py::module& m, char const* type_name) {
         using T             = NTPMat<>;
         using semiring_type = typename T::semiring_type;
         using scalar_type   = typename T::scalar_type;
-        auto x              = bind_matrix_common<T>(m, type_name);
+
+        bind_semiring<semiring_type>(m, "NTPSemiring")
+            .def(py::init([](size_t threshold, size_t period) {
+              // See the comment in bind_matrix_run.
+              return const_cast<semiring_type*>(
+                  semiring<semiring_type>(threshold, period));
+            }))
+            .def("period", [](semiring_type const& sr) { return sr.period(); })
+            .def("__repr__", [](semiring_type const& sr) {
+              return string_format("NTPSemiring(%llu, %llu)",
+                                   static_cast<uint64_t>(sr.threshold()),
+                                   static_cast<uint64_t>(sr.period()));
+            });
+
+        auto x = bind_matrix_common<T>(m, type_name);
+
+        // Returns a function making a matrix from its rows, over the
+        // semiring with the given threshold and period.
+        auto maker = [](size_t threshold, size_t period) {
+          auto const* sr = semiring<semiring_type>(threshold, period);
+          return [sr](std::vector<std::vector<scalar_type>> const& rows) {
+            return T(sr, rows);
+          };
+        };
 
         x.def_static("make",
-                     [](size_t                                       threshold,
-                        size_t                                       period,
-                        std::vector<std::vector<scalar_type>> const& entries) {
-                       // TODO(later) should be T::make but there's no make for
-                       // dynamic runtime matrices and vectors!
-                       auto result = T(
-                           semiring<semiring_type>(threshold, period), entries);
+                     [maker](size_t           threshold,
+                             size_t           period,
+                             py::array const& entries) {
+                       auto result = matrix_from_array<T>(
+                           entries, maker(threshold, period));
                        validate(result);
                        return result;
                      })
+            .def_static(
+                "make",
+                [](size_t                                       threshold,
+                   size_t                                       period,
+                   std::vector<std::vector<scalar_type>> const& entries) {
+                  // TODO(later) should be T::make but there's no make for
+                  // dynamic runtime matrices and vectors!
+                  auto result = T(semiring<semiring_type>(threshold, period),
+                                  entries);
+                  validate(result);
+                  return result;
+                })
+            .def(py::init(
+                [maker](size_t threshold, size_t period, py::array const& a) {
+                  return matrix_from_array<T>(a, maker(threshold, period));
+                }))
             .def(py::init(
                 [](size_t                                       threshold,
                    size_t                                       period,
@@ -247,25 +621,80 @@ namespace libsemigroups {
                           return T::identity(
                               semiring<semiring_type>(threshold, period), n);
                         })
+            .def_static(
+                "products",
+                [maker](size_t            threshold,
+                        size_t            period,
+                        py::object const& a,
+                        py::object const& b) {
+                  return matrix_products<T>(integer_entries<T>(a),
+                                            integer_entries<T>(b),
+                                            maker(threshold, period));
+                },
+                py::arg("threshold"),
+                py::arg("period"),
+                py::arg("a"),
+                py::arg("b"))
+            .def_static(
+                "make_many",
+                [maker](size_t            threshold,
+                        size_t            period,
+                        py::object const& entries) {
+                  return matrices_from_array<T>(integer_entries<T>(entries),
+                                                maker(threshold, period));
+                },
+                py::arg("threshold"),
+                py::arg("period"),
+                py::arg("entries"))
             .def("__repr__", [](T const& x) -> std::string {
               return string_format("Matrix(MatrixKind.NTP, %llu, %llu, %s)",
                                    static_cast<uint64_t>(matrix_threshold(x)),
                                    static_cast<uint64_t>(matrix_period(x)),
                                    matrix_repr(x).c_str());
-            });
+            })
+            .def(py::pickle(
+                [](T const& x) {
+                  return py::make_tuple(
+                      static_cast<size_t>(matrix_threshold(x)),
+                      static_cast<size_t>(matrix_period(x)),
+                      matrix_to_rows(x));
+                },
+                [maker](py::tuple state) {
+                  return maker(state[0].cast<size_t>(),
+                               state[1].cast<size_t>())(
+                      state[2].cast<std::vector<std::vector<scalar_type>>>());
+                }));
+        bind_matrix_semiring(x);
       }
+#endif
 
     }  // namespace
   }    // namespace detail
 
   void init_matrix(py::module& m) {
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_BMAT
     detail::bind_matrix_compile<BMat<>>(m, "BMat");
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_INTMAT
     detail::bind_matrix_compile<IntMat<>>(m, "IntMat");
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_MAXPLUSMAT
     detail::bind_matrix_compile<MaxPlusMat<>>(m, "MaxPlusMat");
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_MINPLUSMAT
     detail::bind_matrix_compile<MinPlusMat<>>(m, "MinPlusMat");
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_PROJMAXPLUSMAT
     detail::bind_matrix_compile<ProjMaxPlusMat<>>(m, "ProjMaxPlusMat");
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_MAXPLUSTRUNCMAT
     detail::bind_matrix_run<MaxPlusTruncMat<>>(m, "MaxPlusTruncMat");
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_MINPLUSTRUNCMAT
     detail::bind_matrix_run<MinPlusTruncMat<>>(m, "MinPlusTruncMat");
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_NTPMAT
     detail::bind_ntp_matrix(m, "NTPMat");
+#endif
   }
 }  // namespace libsemigroups
@@ -0,0 +1,464 @@
+//
+// libsemigroups_pybind11
+// Copyright (C) 2023 James D. Mitchell
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+// This file contains helpers for exposing the data of libsemigroups objects
+// to Python as NumPy arrays (or via the buffer protocol) without copying.
+
+#ifndef SRC_NUMPY_HPP_
+#define SRC_NUMPY_HPP_
+
+// C std headers....
+#include <stddef.h>  // for size_t
+#include <stdint.h>  // for int64_t, uint64_t
+
+// C++ stl headers....
+#include <algorithm>         // for equal
+#include <initializer_list>  // for initializer_list
+#include <limits>            // for numeric_limits
+#include <string>            // for string, to_string
+#include <type_traits>       // for is_signed
+#include <unordered_map>     // for unordered_map
+#include <utility>           // for move
+#include <vector>            // for vector
+
+// libsemigroups....
+#include <libsemigroups/containers.hpp>  // for DynamicArray2
+#include <libsemigroups/digraph.hpp>     // for ActionDigraph
+#include <libsemigroups/exception.hpp>   // for LIBSEMIGROUPS_EXCEPTION
+#include <libsemigroups/types.hpp>       // for word_type
+
+// pybind11....
+#include <pybind11/numpy.h>     // for array_t
+#include <pybind11/pybind11.h>  // for buffer_info, capsule, cast, tuple, ...
+
+namespace libsemigroups {
+  namespace py = pybind11;
+
+  namespace libsemigroups_pybind11 {
+
+    // Returns the (already existing) Python object wrapping x, so that it can
+    // be used as the base of a NumPy array viewing data owned by x.
+    template <typename S>
+    py::object owner(S const& x) {
+      return py::cast(&x, py::return_value_policy::reference);
+    }
+
+    // Returns the map from the address of each bound object, some of whose
+    // data is viewed by a NumPy array created by export_base, to the number
+    // of such arrays. This is only accessed with the GIL held.
+    inline std::unordered_map<void const*, size_t>& exports() {
+      static std::unordered_map<void const*, size_t> result;
+      return result;
+    }
+
+    // Returns a capsule, to be used as the base of a NumPy array viewing data
+    // owned by the bound object x, which keeps the Python object wrapping x
+    // alive, and which is counted in exports() for as long as the capsule
+    // (and hence the array, and any view of it) is alive.
+    template <typename S>
+    py::capsule export_base(S const& x) {
+      struct Export {
+        void const* key;
+        py::object  owner;
+      };
+      auto* ptr = new Export{&x, owner(x)};
+      ++exports()[&x];
+      return py::capsule(ptr, [](void* p) {
+        auto* e  = static_cast<Export*>(p);
+        auto  it = exports().find(e->key);
+        if (--it->second == 0) {
+          exports().erase(it);
+        }
+        delete e;
+      });
+    }
+
+    // Throws if any NumPy array (or buffer) created by export_base is viewing
+    // the data of x. This must be called, with the GIL held, before any
+    // modification of x that might reallocate that data.
+    template <typename S>
+    void throw_if_exported(S const& x) {
+      auto it = exports().find(&x);
+      if (it != exports().cend()) {
+        LIBSEMIGROUPS_EXCEPTION(
+            "cannot modify an object while %llu NumPy array(s) or buffer(s) "
+            "viewing its data exist, delete them first",
+            static_cast<unsigned long long>(it->second));
+      }
+    }
+
+    // Returns a read-only nr_rows x nr_cols NumPy array viewing the table
+    // whose first row starts at data, and whose rows are row_stride entries
+    // apart. Nothing is copied, and base is kept alive for as long as the
+    // returned array (or any view of it) is alive.
+    template <typename T>
+    py::array_t<T> readonly_table(T const* data,
+                                  size_t   nr_rows,
+                                  size_t   nr_cols,
+                                  size_t   row_stride,
+                                  py::object base) {
+      py::array_t<T> result;
+      if (nr_rows == 0 || nr_cols == 0) {
+        result = py::array_t<T>({nr_rows, nr_cols});
+      } else {
+        result = py::array_t<T>({nr_rows, nr_cols},
+                                {row_stride * sizeof(T), sizeof(T)},
+                                data,
+                                base);
+      }
+      result.attr("setflags")(py::arg("write") = false);
+      return result;
+    }
+
+    // Returns the number of entries between the starts of consecutive rows
+    // of the table whose rows are pointed to by f(0), f(1), ...
+    template <typename F>
+    size_t row_stride(F&& f, size_t nr_rows, size_t nr_cols) {
+      if (nr_rows < 2 || nr_cols == 0) {
+        return nr_cols;
+      }
+      return static_cast<size_t>(&*f(1) - &*f(0));
+    }
+
+    // Returns a read-only NumPy array viewing the detail::DynamicArray2 da,
+    // which is a data member of the bound object x. The array is counted in
+    // exports(), and so any function modifying x so that da might be
+    // reallocated must call throw_if_exported(x) first.
+    template <typename T, typename S>
+    py::array_t<T> readonly_table(detail::DynamicArray2<T> const& da,
+                                  S const&                        x) {
+      size_t const nr_rows = da.number_of_rows();
+      size_t const nr_cols = da.number_of_cols();
+      if (nr_rows == 0 || nr_cols == 0) {
+        return readonly_table<T>(nullptr, nr_rows, nr_cols, 0, py::none());
+      }
+      auto row = [&da](size_t i) { return da.cbegin_row(i); };
+      return readonly_table<T>(&*row(0),
+                               nr_rows,
+                               nr_cols,
+                               row_stride(row, nr_rows, nr_cols),
+                               export_base(x));
+    }
+
+    // Returns a read-only NumPy array viewing the table of out-neighbours of
+    // the bound ActionDigraph ad. As above, the array is counted in
+    // exports().
+    template <typename T>
+    py::array_t<T> readonly_table(ActionDigraph<T> const& ad) {
+      size_t const nr_rows = ad.number_of_nodes();
+      size_t const nr_cols = ad.out_degree();
+      if (nr_rows == 0 || nr_cols == 0) {
+        return readonly_table<T>(nullptr, nr_rows, nr_cols, 0, py::none());
+      }
+      auto row = [&ad](size_t i) { return ad.cbegin_edges(i); };
+      return readonly_table<T>(&*row(0),
+                               nr_rows,
+                               nr_cols,
+                               row_stride(row, nr_rows, nr_cols),
+                               export_base(ad));
+    }
+
+    // Returns a read-only buffer_info for the table of out-neighbours of the
+    // ActionDigraph ad. This is used to implement the buffer protocol for
+    // ActionDigraph. The buffer_info holds a buffer of the array returned by
+    // readonly_table(ad), which is released when the buffer_info is deleted,
+    // and so the buffer is counted in exports() for as long as it is alive.
+    template <typename T>
+    py::buffer_info table_buffer_info(ActionDigraph<T> const& ad) {
+      return readonly_table(ad).request();
+    }
+
+    // The type of the array arguments of the batch functions. Any array-like
+    // Python object (such as a list of int) is converted to a C-contiguous
+    // NumPy array with dtype T, if necessary.
+    template <typename T>
+    using input_array
+        = py::array_t<T, py::array::c_style | py::array::forcecast>;
+
+    // Returns true if the integer x can be represented by the type T.
+    template <typename T, typename S>
+    bool is_representable(S x) {
+      if (std::is_signed<S>::value && x < 0) {
+        return std::is_signed<T>::value
+               && static_cast<int64_t>(x)
+                      >= static_cast<int64_t>(std::numeric_limits<T>::min());
+      }
+      return static_cast<uint64_t>(x)
+             <= static_cast<uint64_t>(std::numeric_limits<T>::max());
+    }
+
+    // Throws if any entry of the array a cannot be represented by T.
+    template <typename T, typename S>
+    void throw_if_not_representable(input_array<S> const& a) {
+      S const*     in = a.data();
+      size_t const n  = a.size();
+      for (size_t i = 0; i < n; ++i) {
+        if (!is_representable<T>(in[i])) {
+          LIBSEMIGROUPS_EXCEPTION(
+              "the value %s is out of range, expected values in [%s, %s]",
+              std::to_string(in[i]).c_str(),
+              std::to_string(std::numeric_limits<T>::min()).c_str(),
+              std::to_string(std::numeric_limits<T>::max()).c_str());
+        }
+      }
+    }
+
+    // Returns the array-like object obj converted to an input_array<T>. The
+    // implicit conversion to input_array<T> silently truncates floats, and
+    // wraps integers that T cannot represent (such as negative integers when
+    // T is unsigned), and so this throws instead if any entry of obj is not
+    // an integer (or a bool) that T can represent. Since NumPy gives empty
+    // lists the dtype float64, empty arrays of any dtype are accepted.
+    template <typename T>
+    input_array<T> integer_array(py::object const& obj) {
+      py::array const a = py::array::ensure(obj);
+      if (!a) {
+        LIBSEMIGROUPS_EXCEPTION("expected an array-like object");
+      }
+      if (a.size() != 0) {
+        char const kind = a.dtype().kind();
+        if (kind == 'i') {
+          throw_if_not_representable<T>(a.cast<input_array<int64_t>>());
+        } else if (kind == 'u') {
+          throw_if_not_representable<T>(a.cast<input_array<uint64_t>>());
+        } else if (kind != 'b') {
+          LIBSEMIGROUPS_EXCEPTION(
+              "expected an array of integers, found dtype %s",
+              py::str(a.dtype()).cast<std::string>().c_str());
+        }
+      }
+      return a.cast<input_array<T>>();
+    }
+
+    // Returns the shape of the array a.
+    template <typename T>
+    std::vector<py::ssize_t> shape(input_array<T> const& a) {
+      return std::vector<py::ssize_t>(a.shape(), a.shape() + a.ndim());
+    }
+
+    // Returns the NumPy array, with the same shape as a, obtained by applying
+    // f to every entry of a. The GIL is released while f is being applied,
+    // and so f must not call into Python.
+    template <typename S, typename T, typename F>
+    py::array_t<S> vectorize(input_array<T> const& a, F&& f) {
+      py::array_t<S> result(shape(a));
+      T const*       in  = a.data();
+      S*             out = result.mutable_data();
+      size_t const   n   = a.size();
+      {
+        py::gil_scoped_release release;
+        for (size_t i = 0; i < n; ++i) {
+          out[i] = f(in[i]);
+        }
+      }
+      return result;
+    }
+
+    // As above, but f is applied to the corresponding entries of a and b,
+    // which must have the same shape.
+    template <typename S, typename T, typename F>
+    py::array_t<S> vectorize(input_array<T> const& a,
+                             input_array<T> const& b,
+                             F&&                   f) {
+      if (a.ndim() != b.ndim()
+          || !std::equal(a.shape(), a.shape() + a.ndim(), b.shape())) {
+        LIBSEMIGROUPS_EXCEPTION("the arguments must have the same shape");
+      }
+      py::array_t<S> result(shape(a));
+      T const*       in1 = a.data();
+      T const*       in2 = b.data();
+      S*             out = result.mutable_data();
+      size_t const   n   = a.size();
+      {
+        py::gil_scoped_release release;
+        for (size_t i = 0; i < n; ++i) {
+          out[i] = f(in1[i], in2[i]);
+        }
+      }
+      return result;
+    }
+
+    // Returns the 1-dimensional NumPy array obtained by applying f to every
+    // item of the std::vector v (which has already been converted from
+    // Python). The GIL is released while f is being applied.
+    template <typename S, typename T, typename F>
+    py::array_t<S> vectorize(std::vector<T> const& v, F&& f) {
+      py::array_t<S> result(v.size());
+      S*             out = result.mutable_data();
+      {
+        py::gil_scoped_release release;
+        for (size_t i = 0; i < v.size(); ++i) {
+          out[i] = f(v[i]);
+        }
+      }
+      return result;
+    }
+
+    // The arguments of the batch products are arrays of items, each of which
+    // is an array with item_ndim dimensions (such as the images of a
+    // transformation, or the entries of a matrix). Each argument is either a
+    // single item, which is used in every product, or an array of items, with
+    // one more dimension. All of the items must have the same shape, and if
+    // both arguments are arrays of items, then they must have the same
+    // length. Returns the shape of the array of products.
+    template <typename T>
+    std::vector<py::ssize_t> batch_shape(input_array<T> const& a,
+                                         input_array<T> const& b,
+                                         py::ssize_t           item_ndim) {
+      for (auto const* x : {&a, &b}) {
+        if (x->ndim() != item_ndim && x->ndim() != item_ndim + 1) {
+          LIBSEMIGROUPS_EXCEPTION(
+              "the arguments must have %lld or %lld dimensions, found %lld",
+              static_cast<long long>(item_ndim),
+              static_cast<long long>(item_ndim + 1),
+              static_cast<long long>(x->ndim()));
+        }
+      }
+      if (!std::equal(a.shape() + a.ndim() - item_ndim,
+                      a.shape() + a.ndim(),
+                      b.shape() + b.ndim() - item_ndim)) {
+        LIBSEMIGROUPS_EXCEPTION(
+            "the items in the arguments must have the same shape");
+      }
+      if (a.ndim() > item_ndim && b.ndim() > item_ndim
+          && a.shape(0) != b.shape(0)) {
+        LIBSEMIGROUPS_EXCEPTION("the arguments must have the same length, "
+                                "found %lld and %lld",
+                                static_cast<long long>(a.shape(0)),
+                                static_cast<long long>(b.shape(0)));
+      }
+      return shape(a.ndim() >= b.ndim() ? a : b);
+    }
+
+    // Returns the array of the products of the items in a and b (see
+    // batch_shape), where make(first) returns the element whose item starts
+    // at first (and throws if the item is not valid), prod(z, x, y) sets z to
+    // the product of x and y, and store(z, first) writes the item of z to
+    // first. The GIL is released while the products are being computed.
+    template <typename S,
+              typename T,
+              typename Make,
+              typename Product,
+              typename Store>
+    py::array_t<S> batch_products(input_array<T> const& a,
+                                  input_array<T> const& b,
+                                  py::ssize_t           item_ndim,
+                                  Make&&                make,
+                                  Product&&             prod,
+                                  Store&&               store) {
+      auto const   shp = batch_shape(a, b, item_ndim);
+      size_t const n   = shp.size() > static_cast<size_t>(item_ndim)
+                             ? static_cast<size_t>(shp[0])
+                             : 1;
+      size_t item_size = 1;
+      for (auto it = shp.cend() - item_ndim; it != shp.cend(); ++it) {
+        item_size *= static_cast<size_t>(*it);
+      }
+      size_t const   a_step = a.ndim() > item_ndim ? item_size : 0;
+      size_t const   b_step = b.ndim() > item_ndim ? item_size : 0;
+      py::array_t<S> result(shp);
+      T const*       in1 = a.data();
+      T const*       in2 = b.data();
+      S*             out = result.mutable_data();
+      if (n != 0) {
+        py::gil_scoped_release release;
+        auto                   x = make(in1);
+        auto                   y = make(in2);
+        auto                   z = x;
+        for (size_t i = 0; i < n; ++i) {
+          if (i != 0 && a_step != 0) {
+            x = make(in1 + i * a_step);
+          }
+          if (i != 0 && b_step != 0) {
+            y = make(in2 + i * b_step);
+          }
+          prod(z, x, y);
+          store(z, out + i * item_size);
+        }
+      }
+      return result;
+    }
+
+    // Returns a 1-dimensional NumPy array that takes ownership of the data
+    // in v, rather than copying it.
+    template <typename T>
+    py::array_t<T> to_array(std::vector<T>&& v) {
+      auto*       ptr = new std::vector<T>(std::move(v));
+      py::capsule base(
+          ptr, [](void* p) { delete static_cast<std::vector<T>*>(p); });
+      return py::array_t<T>(
+          static_cast<py::ssize_t>(ptr->size()), ptr->data(), base);
+    }
+
+    // Returns the words stored in the flat format used by the batch functions
+    // taking and returning many words: the i-th word consists of the letters
+    // letters[offsets[i]:offsets[i + 1]]. This is the inverse of
+    // flatten_words. Both offsets and letters are converted using
+    // integer_array, and so floats and negative integers are rejected.
+    inline std::vector<word_type>
+    unflatten_words(py::object const& offsets_obj,
+                    py::object const& letters_obj) {
+      auto const offsets = integer_array<size_t>(offsets_obj);
+      auto const letters = integer_array<size_t>(letters_obj);
+      if (offsets.ndim() != 1 || letters.ndim() != 1) {
+        LIBSEMIGROUPS_EXCEPTION("the arguments must be 1-dimensional arrays");
+      }
+      size_t const  n     = offsets.size();
+      size_t const* first = offsets.data();
+      size_t const* data  = letters.data();
+      for (size_t i = 0; i < n; ++i) {
+        if ((i > 0 && first[i] < first[i - 1])
+            || first[i] > static_cast<size_t>(letters.size())) {
+          LIBSEMIGROUPS_EXCEPTION("invalid offset %llu at index %llu, "
+                                  "expected a value in [%llu, %llu]",
+                                  uint64_t(first[i]),
+                                  uint64_t(i),
+                                  uint64_t(i > 0 ? first[i - 1] : 0),
+                                  uint64_t(letters.size()));
+        }
+      }
+      std::vector<word_type> result(n == 0 ? 0 : n - 1);
+      {
+        py::gil_scoped_release release;
+        for (size_t i = 0; i < result.size(); ++i) {
+          result[i].assign(data + first[i], data + first[i + 1]);
+        }
+      }
+      return result;
+    }
+
+    // Returns the tuple (offsets, letters) of NumPy arrays storing the words
+    // in words in the flat format described above.
+    inline py::tuple flatten_words(std::vector<word_type> const& words) {
+      std::vector<size_t> offsets(1, 0);
+      std::vector<size_t> letters;
+      {
+        py::gil_scoped_release release;
+        offsets.reserve(words.size() + 1);
+        for (auto const& w : words) {
+          letters.insert(letters.end(), w.cbegin(), w.cend());
+          offsets.push_back(letters.size());
+        }
+      }
+      return py::make_tuple(to_array(std::move(offsets)),
+                            to_array(std::move(letters)));
+    }
+  }  // namespace libsemigroups_pybind11
+}  // namespace libsemigroups
+
+#endif  // SRC_NUMPY_HPP_
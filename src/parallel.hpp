@@ -0,0 +1,99 @@
+//
+// libsemigroups_pybind11
+// Copyright (C) 2023 James D. Mitchell
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+// This file contains helpers for running the batch functions, which apply a
+// const member function of some object to many arguments, in several threads.
+// The GIL must be released before calling any of these, and the functions
+// they call must not call into Python.
+
+#ifndef SRC_PARALLEL_HPP_
+#define SRC_PARALLEL_HPP_
+
+// C std headers....
+#include <stddef.h>  // for size_t
+
+// C++ stl headers....
+#include <algorithm>  // for max, min
+#include <exception>  // for exception_ptr, current_exception, rethrow_...
+#include <thread>     // for thread
+#include <vector>     // for vector
+
+namespace libsemigroups {
+  namespace libsemigroups_pybind11 {
+
+    // Returns the number of threads to use for n tasks when the user asked
+    // for max_threads threads; 0 means as many as the hardware supports.
+    inline size_t number_of_threads(size_t n, size_t max_threads) {
+      if (max_threads == 0) {
+        max_threads = std::thread::hardware_concurrency();
+      }
+      return std::max(std::min(max_threads, n), size_t(1));
+    }
+
+    // Calls f(t, first, last) for every thread t in [0,
+    // number_of_threads(n, max_threads)), where the ranges [first, last)
+    // are contiguous, partition [0, n), and are as equal in size as
+    // possible. Thread 0 is the calling thread. If f throws in any thread,
+    // then the first such exception (by thread) is rethrown once all the
+    // threads have finished.
+    template <typename F>
+    void parallel_for_ranges(size_t n, size_t max_threads, F&& f) {
+      size_t const nr_threads = number_of_threads(n, max_threads);
+      if (nr_threads == 1) {
+        f(size_t(0), size_t(0), n);
+        return;
+      }
+      std::vector<std::exception_ptr> errors(nr_threads);
+      auto work = [n, nr_threads, &errors, &f](size_t t) {
+        try {
+          f(t, (n * t) / nr_threads, (n * (t + 1)) / nr_threads);
+        } catch (...) {
+          errors[t] = std::current_exception();
+        }
+      };
+      std::vector<std::thread> threads;
+      for (size_t t = 1; t < nr_threads; ++t) {
+        threads.emplace_back(work, t);
+      }
+      work(0);
+      for (auto& thread : threads) {
+        thread.join();
+      }
+      for (auto const& err : errors) {
+        if (err) {
+          std::rethrow_exception(err);
+        }
+      }
+    }
+
+    // Calls f(i) for every i in [0, n), using at most max_threads threads
+    // (including the calling thread), each of which processes a contiguous
+    // range of indices, see parallel_for_ranges.
+    template <typename F>
+    void parallel_for(size_t n, size_t max_threads, F&& f) {
+      parallel_for_ranges(
+          n, max_threads, [&f](size_t, size_t first, size_t last) {
+            for (size_t i = first; i < last; ++i) {
+              f(i);
+            }
+          });
+    }
+  }  // namespace libsemigroups_pybind11
+}  // namespace libsemigroups
+
+#endif  // SRC_PARALLEL_HPP_
@@ -0,0 +1,181 @@
+//
+// libsemigroups_pybind11
+// Copyright (C) 2023 James D. Mitchell
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+// This file contains the class PathChunks, which is used to return the paths
+// of an ActionDigraph (such as the word graph of a Stephen instance), or any
+// other range of words or strings, to Python in chunks of NumPy arrays,
+// rather than one list per path.
+
+#ifndef SRC_PATH_CHUNKS_HPP_
+#define SRC_PATH_CHUNKS_HPP_
+
+// C std headers....
+#include <stddef.h>  // for size_t
+
+// C++ stl headers....
+#include <string>       // for string
+#include <type_traits>  // for conditional, decay, is_same
+#include <utility>      // for declval, move, pair
+#include <vector>       // for vector
+
+// libsemigroups....
+#include <libsemigroups/types.hpp>  // for word_type
+
+// pybind11....
+#include <pybind11/numpy.h>     // for array_t
+#include <pybind11/pybind11.h>  // for bytes, class_, tuple, stop_iteration
+
+// libsemigroups_pybind11....
+#include "numpy.hpp"  // for to_array
+
+namespace libsemigroups {
+  namespace py = pybind11;
+
+  namespace libsemigroups_pybind11 {
+    inline word_type const& path(word_type const& w) {
+      return w;
+    }
+
+    inline word_type const& path(std::pair<word_type, size_t> const& p) {
+      return p.first;
+    }
+
+    inline std::string const& path(std::string const& w) {
+      return w;
+    }
+
+    inline void add_target(std::vector<size_t>&, word_type const&) {}
+
+    inline void add_target(std::vector<size_t>&, std::string const&) {}
+
+    inline void add_target(std::vector<size_t>&                targets,
+                           std::pair<word_type, size_t> const& p) {
+      targets.push_back(p.second);
+    }
+
+    inline py::array_t<size_t> letters_object(std::vector<size_t>&& letters) {
+      return to_array(std::move(letters));
+    }
+
+    inline py::bytes letters_object(std::string&& letters) {
+      return py::bytes(letters);
+    }
+
+    // A Python iterator yielding the paths of an ActionDigraph in chunks,
+    // the iteration state is kept in C++ between chunks. Each chunk is a
+    // tuple (offsets, letters) of NumPy arrays such that the i-th path in the
+    // chunk is letters[offsets[i]:offsets[i + 1]]. If Iterator is a panilo or
+    // panislo iterator, then each chunk also contains a third array whose
+    // i-th entry is the last node of the i-th path. Iterator can also be any
+    // other iterator of words (such as a wilo iterator), or of strings (such
+    // as a silo iterator), in which case letters is a bytes object.
+    template <typename Iterator>
+    class PathChunks {
+      using value_type =
+          typename std::decay<decltype(*std::declval<Iterator>())>::type;
+      static constexpr bool has_targets
+          = std::is_same<value_type, std::pair<word_type, size_t>>::value;
+      static constexpr bool is_string
+          = std::is_same<value_type, std::string>::value;
+      using letters_type =
+          typename std::conditional<is_string,
+                                    std::string,
+                                    std::vector<size_t>>::type;
+
+     public:
+      PathChunks(Iterator first, Iterator last, size_t chunk_size)
+          : _chunk_size(chunk_size == 0 ? 1 : chunk_size),
+            _first(first),
+            _last(last) {}
+
+      size_t chunk_size() const noexcept {
+        return _chunk_size;
+      }
+
+      bool exhausted() const {
+        return _first == _last;
+      }
+
+      // Returns the next (at most) k paths, the GIL is released while the
+      // paths are enumerated.
+      py::tuple next(size_t k) {
+        std::vector<size_t> offsets(1, 0);
+        letters_type        letters;
+        std::vector<size_t> targets;
+        {
+          py::gil_scoped_release release;
+          for (size_t i = 0; i < k && _first != _last; ++i, ++_first) {
+            auto const& w = path(*_first);
+            letters.insert(letters.end(), w.cbegin(), w.cend());
+            offsets.push_back(letters.size());
+            add_target(targets, *_first);
+          }
+        }
+        if (has_targets) {
+          return py::make_tuple(to_array(std::move(offsets)),
+                                letters_object(std::move(letters)),
+                                to_array(std::move(targets)));
+        }
+        return py::make_tuple(to_array(std::move(offsets)),
+                              letters_object(std::move(letters)));
+      }
+
+     private:
+      size_t const _chunk_size;
+      Iterator     _first;
+      Iterator     _last;
+    };
+
+    template <typename Iterator>
+    PathChunks<Iterator>* make_path_chunks(Iterator first,
+                                           Iterator last,
+                                           size_t   chunk_size) {
+      return new PathChunks<Iterator>(first, last, chunk_size);
+    }
+
+    template <typename Iterator>
+    void bind_path_chunks(py::module& m, char const* name) {
+      using Class = PathChunks<Iterator>;
+      py::class_<Class>(m, name)
+          .def("__iter__", [](py::object self) { return self; })
+          .def("__next__",
+               [](Class& x) {
+                 if (x.exhausted()) {
+                   throw py::stop_iteration();
+                 }
+                 return x.next(x.chunk_size());
+               })
+          .def(
+              "next",
+              [](Class& x, size_t k) { return x.next(k); },
+              py::arg("k"),
+              R"pbdoc(
+                Returns the next (at most) ``k`` paths.
+
+                :Parameters: **k** (int) the maximum number of paths.
+                :Returns:
+                  A tuple of ``numpy.ndarray``, which contains no paths if
+                  there are no more paths.
+              )pbdoc")
+          .def("chunk_size", &Class::chunk_size)
+          .def("exhausted", &Class::exhausted);
+    }
+  }  // namespace libsemigroups_pybind11
+}  // namespace libsemigroups
+
+#endif  // SRC_PATH_CHUNKS_HPP_
@@ -33,7 +33,8 @@
 #include <pybind11/stl.h>
 
 // libsemigroups_pybind11....
-#include "main.hpp"  // for init_pbr
+#include "elements.hpp"  // for LIBSEMIGROUPS_PYBIND11_ENABLE_PBR
+#include "main.hpp"      // for init_pbr
 
 namespace py = pybind11;
 
@@ -41,6 +42,7 @@ namespace libsemigroups {
   template <typename T>
   using vector_type = typename PBR::vector_type<T>;
 
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_PBR
   void init_pbr(py::module& m) {
     py::class_<PBR>(m, "PBR")
         .def(py::init<PBR const&>(),
@@ -51,6 +53,18 @@ namespace libsemigroups {
                :param that: the ``PBR`` to copy.
                :type that: PBR
              )pbdoc")
+        .def(py::pickle(
+            [](PBR const& x) {
+              vector_type<vector_type<uint32_t>> adj;
+              for (size_t i = 0; i < 2 * x.degree(); ++i) {
+                adj.push_back(x[i]);
+              }
+              return py::make_tuple(adj);
+            },
+            [](py::tuple state) {
+              return PBR::make(
+                  state[0].cast<vector_type<vector_type<uint32_t>>>());
+            }))
         .def("identity",
              py::overload_cast<>(&PBR::identity, py::const_),
              R"pbdoc(
@@ -166,4 +180,5 @@ namespace libsemigroups {
              )pbdoc")
         .def("__hash__", &PBR::hash_value);
   }
+#endif
 }  // namespace libsemigroups
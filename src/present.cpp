@@ -21,13 +21,19 @@
 
 // C std headers....
 #include <stddef.h>  // for size_t
-#include <stdint.h>  // for int32_t, uint32_t
+#include <stdint.h>  // for int32_t, uint32_t, uint64_t, uint8_t
 
 // C++ stl headers....
+#include <algorithm>         // for min
+#include <fstream>           // for ifstream, ofstream
 #include <initializer_list>  // for initializer_list
+#include <ios>               // for ios
+#include <string>            // for string
+#include <utility>           // for move
 #include <vector>            // for vector
 
 // libsemigroups....
+#include <libsemigroups/exception.hpp>          // for LIBSEMIGROUPS_EXCEPTION
 #include <libsemigroups/froidure-pin-base.hpp>  // for FroidurePinBase
 #include <libsemigroups/make-present.hpp>       // for make
 #include <libsemigroups/present.hpp>            // for Presentation
@@ -56,6 +62,284 @@ namespace libsemigroups {
       return out.str();
     }
 
+    ////////////////////////////////////////////////////////////////////////
+    // Rules view
+    ////////////////////////////////////////////////////////////////////////
+
+    // A read-only view of the rules of a presentation, so that a single rule
+    // can be converted to Python without converting all of them, which is
+    // what happens when Presentation.rules is accessed. A view refers to its
+    // presentation (not to the rules), and so remains valid if the rules are
+    // modified or replaced.
+    template <typename T>
+    class RulesView {
+     public:
+      explicit RulesView(Presentation<T> const& p) : _p(&p) {}
+
+      size_t size() const noexcept {
+        return _p->rules.size();
+      }
+
+      T const& word(py::ssize_t i) const {
+        return _p->rules[index(i, size(), "word")];
+      }
+
+      py::tuple rule(py::ssize_t i) const {
+        size_t j = index(i, size() / 2, "rule");
+        return py::make_tuple(_p->rules[2 * j], _p->rules[2 * j + 1]);
+      }
+
+      size_t number_of_rules() const noexcept {
+        return size() / 2;
+      }
+
+     private:
+      // Returns i as an index into a sequence of length n, where negative
+      // values of i count from the end, as for a Python list.
+      static size_t index(py::ssize_t i, size_t n, char const* what) {
+        if (i < 0) {
+          i += static_cast<py::ssize_t>(n);
+        }
+        if (i < 0 || static_cast<size_t>(i) >= n) {
+          throw py::index_error(std::string(what) + " index out of range");
+        }
+        return static_cast<size_t>(i);
+      }
+
+      Presentation<T> const* _p;
+    };
+
+    ////////////////////////////////////////////////////////////////////////
+    // Reading and writing
+    ////////////////////////////////////////////////////////////////////////
+
+    // A presentation is stored in a file as follows, where every integer is
+    // stored in the variable length (LEB128) format of write_uint:
+    //
+    // * the 8 bytes of presentation_magic (which includes the version);
+    // * 0 if the words are lists of int and 1 if they are strings;
+    // * 1 if the presentation contains the empty word and 0 if not;
+    // * the alphabet, and then each of the rules, stored as words.
+    //
+    // A word is stored as its length followed by its letters; letters are
+    // stored as integers if the words are lists of int, and as single bytes
+    // if the words are strings.
+    constexpr char presentation_magic[] = "LSGPRES\x01";
+
+    void write_uint(std::ostream& os, uint64_t x) {
+      while (x >= 0x80) {
+        os.put(static_cast<char>((x & 0x7F) | 0x80));
+        x >>= 7;
+      }
+      os.put(static_cast<char>(x));
+    }
+
+    uint64_t read_uint(std::istream& is) {
+      uint64_t result = 0;
+      for (unsigned shift = 0; shift < 64; shift += 7) {
+        auto c = is.get();
+        if (c == std::istream::traits_type::eof()) {
+          LIBSEMIGROUPS_EXCEPTION("unexpected end of file");
+        }
+        result |= static_cast<uint64_t>(c & 0x7F) << shift;
+        if ((c & 0x80) == 0) {
+          return result;
+        }
+      }
+      LIBSEMIGROUPS_EXCEPTION("invalid integer in file");
+    }
+
+    uint8_t presentation_kind(word_type const*) {
+      return 0;
+    }
+
+    uint8_t presentation_kind(std::string const*) {
+      return 1;
+    }
+
+    void write_word(std::ostream& os, word_type const& w) {
+      write_uint(os, w.size());
+      for (auto x : w) {
+        write_uint(os, x);
+      }
+    }
+
+    void write_word(std::ostream& os, std::string const& w) {
+      write_uint(os, w.size());
+      os.write(w.data(), w.size());
+    }
+
+    // The length of a word is not trusted to allocate memory, in case the
+    // file is corrupt.
+    void read_word(std::istream& is, word_type& w) {
+      uint64_t n = read_uint(is);
+      w.clear();
+      w.reserve(std::min(n, uint64_t(1) << 16));
+      for (uint64_t i = 0; i < n; ++i) {
+        w.push_back(read_uint(is));
+      }
+    }
+
+    void read_word(std::istream& is, std::string& w) {
+      uint64_t n = read_uint(is);
+      w.clear();
+      while (n > 0) {
+        size_t const chunk = std::min(n, uint64_t(1) << 16);
+        size_t const old   = w.size();
+        w.resize(old + chunk);
+        if (!is.read(&w[old], chunk)) {
+          LIBSEMIGROUPS_EXCEPTION("unexpected end of file");
+        }
+        n -= chunk;
+      }
+    }
+
+    template <typename T>
+    void write_presentation(Presentation<T> const& p,
+                            std::string const&     filename) {
+      py::gil_scoped_release release;
+      std::ofstream          os(filename, std::ios::binary);
+      if (!os) {
+        LIBSEMIGROUPS_EXCEPTION("cannot open %s for writing",
+                                filename.c_str());
+      }
+      os.write(presentation_magic, sizeof(presentation_magic) - 1);
+      os.put(static_cast<char>(presentation_kind(&p.alphabet())));
+      os.put(p.contains_empty_word() ? 1 : 0);
+      write_word(os, p.alphabet());
+      write_uint(os, p.rules.size());
+      for (auto const& w : p.rules) {
+        write_word(os, w);
+      }
+      if (!os.flush()) {
+        LIBSEMIGROUPS_EXCEPTION("error writing to %s", filename.c_str());
+      }
+    }
+
+    template <typename T>
+    Presentation<T> read_presentation_body(std::istream& is) {
+      Presentation<T> p;
+      p.contains_empty_word(is.get() == 1);
+      T alphabet;
+      read_word(is, alphabet);
+      p.alphabet(alphabet);
+      uint64_t n = read_uint(is);
+      p.rules.reserve(std::min(n, uint64_t(1) << 16));
+      for (uint64_t i = 0; i < n; ++i) {
+        p.rules.emplace_back();
+        read_word(is, p.rules.back());
+      }
+      p.validate();
+      return p;
+    }
+
+    // Returns a PresentationWords or PresentationStrings depending on the
+    // contents of the file.
+    py::object read_presentation(std::string const& filename) {
+      std::ifstream is(filename, std::ios::binary);
+      if (!is) {
+        LIBSEMIGROUPS_EXCEPTION("cannot open %s for reading",
+                                filename.c_str());
+      }
+      char magic[sizeof(presentation_magic) - 1];
+      if (!is.read(magic, sizeof(magic))
+          || !std::equal(magic, magic + sizeof(magic), presentation_magic)) {
+        LIBSEMIGROUPS_EXCEPTION("%s is not a presentation file, or has an "
+                                "unsupported version",
+                                filename.c_str());
+      }
+      auto const kind = is.get();
+      if (kind == 0) {
+        Presentation<word_type> p;
+        {
+          py::gil_scoped_release release;
+          p = read_presentation_body<word_type>(is);
+        }
+        return py::cast(std::move(p));
+      } else if (kind == 1) {
+        Presentation<std::string> p;
+        {
+          py::gil_scoped_release release;
+          p = read_presentation_body<std::string>(is);
+        }
+        return py::cast(std::move(p));
+      }
+      LIBSEMIGROUPS_EXCEPTION("invalid presentation kind %d in %s",
+                              static_cast<int>(kind),
+                              filename.c_str());
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+    // Simplification
+    ////////////////////////////////////////////////////////////////////////
+
+    template <typename T>
+    using simplify_pass = void (*)(Presentation<T>&);
+
+    // Returns the helper function called name, which can be used as a pass in
+    // simplify, or throws if there is no such pass.
+    template <typename T>
+    simplify_pass<T> simplify_pass_by_name(std::string const& name) {
+      if (name == "greedy_reduce_length") {
+        return [](Presentation<T>& p) {
+          presentation::greedy_reduce_length(p);
+        };
+      } else if (name == "normalize_alphabet") {
+        return [](Presentation<T>& p) { presentation::normalize_alphabet(p); };
+      } else if (name == "reduce_complements") {
+        return [](Presentation<T>& p) { presentation::reduce_complements(p); };
+      } else if (name == "remove_duplicate_rules") {
+        return [](Presentation<T>& p) {
+          presentation::remove_duplicate_rules(p);
+        };
+      } else if (name == "remove_redundant_generators") {
+        return [](Presentation<T>& p) {
+          presentation::remove_redundant_generators(p);
+        };
+      } else if (name == "remove_trivial_rules") {
+        return [](Presentation<T>& p) {
+          presentation::remove_trivial_rules(p);
+        };
+      } else if (name == "sort_each_rule") {
+        return [](Presentation<T>& p) { presentation::sort_each_rule(p); };
+      } else if (name == "sort_rules") {
+        return [](Presentation<T>& p) { presentation::sort_rules(p); };
+      } else if (name == "strongly_compress") {
+        return [](Presentation<T>& p) { presentation::strongly_compress(p); };
+      }
+      LIBSEMIGROUPS_EXCEPTION("unknown simplification pass \"%s\"",
+                              name.c_str());
+    }
+
+    // Applies the helper functions named in passes to p, in order, without
+    // the GIL. If repeat is true, then this is repeated for as long as the
+    // sum of the lengths of the alphabet and the rules decreases. The passes
+    // are applied to a copy of p, which replaces p only if every pass
+    // succeeds, so that p is unchanged if any of them throws.
+    template <typename T>
+    void simplify(Presentation<T>&                p,
+                  std::vector<std::string> const& passes,
+                  bool                            repeat) {
+      std::vector<simplify_pass<T>> funcs;
+      for (auto const& name : passes) {
+        funcs.push_back(simplify_pass_by_name<T>(name));
+      }
+      py::gil_scoped_release release;
+      Presentation<T>        q(p);
+
+      auto size = [&q]() {
+        return presentation::length(q) + q.alphabet().size();
+      };
+      size_t before;
+      do {
+        before = size();
+        for (auto const& f : funcs) {
+          f(q);
+        }
+      } while (repeat && size() < before);
+      p = std::move(q);
+    }
+
     template <typename T>
     void bind_present(py::module& m, std::string const& name) {
       using size_type = typename Presentation<T>::size_type;
@@ -78,6 +362,10 @@ namespace libsemigroups {
           .def("contains_empty_word",
                py::overload_cast<bool>(&Presentation<T>::contains_empty_word))
           .def_readwrite("rules", &Presentation<T>::rules)
+          .def(
+              "rules_view",
+              [](Presentation<T> const& p) { return RulesView<T>(p); },
+              py::keep_alive<0, 1>())
           .def("validate_alphabet",
                py::overload_cast<>(&Presentation<T>::validate_alphabet,
                                    py::const_))
@@ -86,6 +374,12 @@ namespace libsemigroups {
           .def("validate", &Presentation<T>::validate)
           .def("__repr__", &presentation_repr<T>);
 
+      py::class_<RulesView<T>>(m, (name + "RulesView").c_str())
+          .def("__len__", &RulesView<T>::size)
+          .def("__getitem__", &RulesView<T>::word, py::arg("i"))
+          .def("number_of_rules", &RulesView<T>::number_of_rules)
+          .def("rule", &RulesView<T>::rule, py::arg("i"));
+
       m.def("add_rule",
             py::overload_cast<Presentation<T>&, T const&, T const&>(
                 &presentation::add_rule<T>));
@@ -162,11 +456,21 @@ namespace libsemigroups {
             &presentation::reduce_to_2_generators<T>,
             py::arg("p"),
             py::arg("index") = 0);
+      m.def("simplify",
+            &simplify<T>,
+            py::arg("p"),
+            py::arg("passes"),
+            py::arg("repeat") = false);
+      m.def("write_presentation",
+            &write_presentation<T>,
+            py::arg("p"),
+            py::arg("filename"));
     }
   }  // namespace
 
   void init_present(py::module& m) {
     bind_present<word_type>(m, "PresentationWords");
     bind_present<std::string>(m, "PresentationStrings");
+    m.def("read_presentation", &read_presentation, py::arg("filename"));
   }
 }  // namespace libsemigroups
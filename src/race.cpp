@@ -0,0 +1,389 @@
+//
+// libsemigroups_pybind11
+// Copyright (C) 2023 James D. Mitchell
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+// C std headers....
+#include <stddef.h>  // for size_t
+#include <stdint.h>  // for int64_t
+
+// C++ stl headers....
+#include <algorithm>   // for find
+#include <atomic>      // for atomic
+#include <chrono>      // for nanoseconds
+#include <exception>   // for exception_ptr, make_exception_ptr, rethrow_...
+#include <functional>  // for function
+#include <string>      // for string
+#include <utility>     // for move
+#include <vector>      // for vector
+
+// libsemigroups....
+#include <libsemigroups/cong.hpp>          // for Congruence
+#include <libsemigroups/constants.hpp>     // for UNDEFINED
+#include <libsemigroups/exception.hpp>     // for LIBSEMIGROUPS_EXCEPTION
+#include <libsemigroups/fpsemi.hpp>        // for FpSemigroup
+#include <libsemigroups/froidure-pin.hpp>  // for FroidurePinBase
+#include <libsemigroups/kambites.hpp>      // for Kambites
+#include <libsemigroups/knuth-bendix.hpp>  // for KnuthBendix
+#include <libsemigroups/runner.hpp>        // for Runner
+#include <libsemigroups/todd-coxeter.hpp>  // for ToddCoxeter
+
+// pybind11....
+#include <pybind11/chrono.h>    // for auto conversion of py types for run_for
+#include <pybind11/pybind11.h>  // for class_, init, module, object
+
+// libsemigroups_pybind11....
+#include "cancellation.hpp"  // for CancellationToken
+#include "main.hpp"          // for init_race
+#include "parallel.hpp"      // for number_of_threads, parallel_for
+#include "runner.hpp"        // for is_main_thread, nanoseconds_now
+
+namespace py = pybind11;
+
+namespace libsemigroups {
+  namespace {
+    using libsemigroups_pybind11::CancellationToken;
+    using libsemigroups_pybind11::nanoseconds_now;
+
+    // Returns a pointer to the Runner wrapped by the Python object x, or
+    // throws if x does not wrap a Runner.
+    Runner* to_runner(py::handle x) {
+      if (py::isinstance<congruence::ToddCoxeter>(x)) {
+        return &x.cast<congruence::ToddCoxeter&>();
+      } else if (py::isinstance<fpsemigroup::KnuthBendix>(x)) {
+        return &x.cast<fpsemigroup::KnuthBendix&>();
+      } else if (py::isinstance<
+                     fpsemigroup::Kambites<detail::MultiStringView>>(x)) {
+        return &x.cast<fpsemigroup::Kambites<detail::MultiStringView>&>();
+      } else if (py::isinstance<Congruence>(x)) {
+        return &x.cast<Congruence&>();
+      } else if (py::isinstance<FpSemigroup>(x)) {
+        return &x.cast<FpSemigroup&>();
+      } else if (py::isinstance<FroidurePinBase>(x)) {
+        return &x.cast<FroidurePinBase&>();
+      }
+      LIBSEMIGROUPS_EXCEPTION(
+          "expected ToddCoxeter, KnuthBendix, Kambites, Congruence, "
+          "FpSemigroup, or FroidurePin, found %s",
+          py::str(x.get_type()).cast<std::string>().c_str());
+    }
+
+    // A Race runs several Runners, each in its own thread and without the
+    // GIL, until one of them finishes, and then kills all of the others.
+    // This is the same as libsemigroups::detail::Race, which is used by
+    // Congruence and FpSemigroup, except that the Runners are Python
+    // objects, which are kept alive by the Race.
+    class Race {
+     public:
+      Race() : _max_threads(0), _objects(), _runners(), _winner(UNDEFINED) {}
+
+      void add_runner(py::object x) {
+        if (_winner != UNDEFINED) {
+          LIBSEMIGROUPS_EXCEPTION(
+              "cannot add a runner to a race that has already been won");
+        }
+        Runner* r = to_runner(x);
+        if (std::find(_runners.cbegin(), _runners.cend(), r)
+            != _runners.cend()) {
+          LIBSEMIGROUPS_EXCEPTION("the argument has already been added");
+        }
+        _objects.push_back(std::move(x));
+        _runners.push_back(r);
+      }
+
+      void max_threads(size_t val) noexcept {
+        _max_threads = val;
+      }
+
+      size_t max_threads() const noexcept {
+        return _max_threads;
+      }
+
+      size_t number_of_runners() const noexcept {
+        return _runners.size();
+      }
+
+      py::object runner(size_t i) const {
+        if (i >= _objects.size()) {
+          throw py::index_error("runner index out of range");
+        }
+        return _objects[i];
+      }
+
+      bool finished() const noexcept {
+        return _winner != UNDEFINED;
+      }
+
+      py::object winner() const {
+        return finished() ? _objects[_winner] : py::none();
+      }
+
+      py::object winner_index() const {
+        return finished() ? py::int_(_winner) : py::none();
+      }
+
+      py::object run() {
+        return run_func(nullptr);
+      }
+
+      py::object run_for(std::chrono::nanoseconds t) {
+        int64_t const deadline = nanoseconds_now() + t.count();
+        return run_func([deadline]() { return nanoseconds_now() >= deadline; });
+      }
+
+      py::object run_until(CancellationToken const& token) {
+        return run_func([token]() { return token.cancelled(); });
+      }
+
+     private:
+      // Runs each of the first number_of_threads() runners, in separate
+      // threads, until it finishes or stop (if not empty) returns true. The
+      // first runner to be finished is the winner, and it kills all of the
+      // other runners, which stops them. If running any runner throws, then
+      // all of the other runners are killed, and the exception is rethrown
+      // once they have stopped. If the race is run in the main thread, then
+      // the runner in that thread reacquires the GIL at most once every 50ms
+      // to call PyErr_CheckSignals, so that Python signal handlers (such as
+      // the one raising KeyboardInterrupt, or the one installed by
+      // CancellationToken.cancel_on_signal) run, see run_until_cancelled, and
+      // any exception raised by them is treated in the same way.
+      py::object run_func(std::function<bool()> stop) {
+        if (_runners.empty()) {
+          LIBSEMIGROUPS_EXCEPTION("no runners have been added");
+        }
+        if (finished()) {
+          return winner();
+        }
+        size_t const n = libsemigroups_pybind11::number_of_threads(
+            _runners.size(), _max_threads);
+        // The runner with index 0 is run in the calling thread.
+        std::function<bool()> stop_0 = stop;
+        std::exception_ptr    err;
+        if (libsemigroups_pybind11::is_main_thread()) {
+          int64_t const signal_poll = 50000000;  // 50ms
+          int64_t       last        = nanoseconds_now();
+          stop_0 = [stop, &err, last, signal_poll]() mutable {
+            if (stop && stop()) {
+              return true;
+            }
+            int64_t const now = nanoseconds_now();
+            if (now - last < signal_poll) {
+              return false;
+            }
+            last = now;
+            py::gil_scoped_acquire gil;
+            if (PyErr_CheckSignals() != 0) {
+              err = std::make_exception_ptr(py::error_already_set());
+              return true;
+            }
+            return false;
+          };
+        }
+        {
+          // The GIL is released only in this block.
+          std::atomic<size_t>    winner(UNDEFINED);
+          py::gil_scoped_release release;
+          libsemigroups_pybind11::parallel_for(
+              n, n, [this, n, &winner, &stop, &stop_0, &err](size_t i) {
+                try {
+                  std::function<bool()> pred = (i == 0 ? stop_0 : stop);
+                  if (pred) {
+                    _runners[i]->run_until(pred);
+                  } else {
+                    _runners[i]->run();
+                  }
+                  if (i == 0 && err) {
+                    std::rethrow_exception(err);
+                  }
+                } catch (...) {
+                  kill_all_except(i, n);
+                  throw;
+                }
+                size_t expected = UNDEFINED;
+                if (_runners[i]->finished()
+                    && winner.compare_exchange_strong(expected, i)) {
+                  _winner = i;
+                  kill_all_except(i, n);
+                }
+              });
+        }
+        return winner();
+      }
+
+      // Kills each of the first n runners, other than the i-th.
+      void kill_all_except(size_t i, size_t n) {
+        for (size_t j = 0; j < n; ++j) {
+          if (j != i) {
+            _runners[j]->kill();
+          }
+        }
+      }
+
+      size_t                  _max_threads;
+      std::vector<py::object> _objects;
+      std::vector<Runner*>    _runners;
+      size_t                  _winner;
+    };
+  }  // namespace
+
+  void init_race(py::module& m) {
+    py::class_<Race>(m,
+                     "Race",
+                     R"pbdoc(
+      A :py:class:`Race` runs several algorithms, each in its own thread,
+      until the first of them finishes; this algorithm is the winner, and
+      every other algorithm in the race is killed.
+
+      Unlike :py:class:`Congruence` and :py:class:`FpSemigroup`, which race a
+      fixed collection of algorithms, the algorithms in a :py:class:`Race`
+      can be any (configured) instances of :py:class:`ToddCoxeter`,
+      :py:class:`KnuthBendix`, :py:class:`Kambites`, :py:class:`Congruence`,
+      :py:class:`FpSemigroup`, or :py:class:`FroidurePin`. The GIL is not
+      held while the race runs, but if the race is run in the main thread,
+      then Python signal handlers (such as the one raising
+      ``KeyboardInterrupt``) still run. If any algorithm raises an
+      exception, then every other algorithm in the race is killed, and the
+      exception is re-raised.
+
+      .. warning::
+         The algorithms that lose a race are killed, and so cannot be run
+         again.
+    )pbdoc")
+        .def(py::init<>(),
+             R"pbdoc(
+               Constructs an empty :py:class:`Race`.
+             )pbdoc")
+        .def("add_runner",
+             &Race::add_runner,
+             py::arg("x"),
+             R"pbdoc(
+               Add an algorithm to the race.
+
+               :param x: the algorithm.
+               :type x:
+                 ToddCoxeter, KnuthBendix, Kambites, Congruence, FpSemigroup,
+                 or FroidurePin
+
+               :return: None
+
+               :Raises:
+                 ``RuntimeError`` if ``x`` is not one of the types listed
+                 above, if ``x`` has already been added, or if the race has
+                 already been won.
+             )pbdoc")
+        .def("max_threads",
+             py::overload_cast<size_t>(&Race::max_threads),
+             py::arg("val"),
+             R"pbdoc(
+               Set the maximum number of threads used by the race.
+
+               Only the first ``val`` algorithms in the race are run; if
+               ``val`` is ``0`` (the default), then this is the number of
+               threads supported by the hardware.
+
+               :param val: the maximum number of threads.
+               :type val: int
+
+               :return: None
+             )pbdoc")
+        .def("max_threads",
+             py::overload_cast<>(&Race::max_threads, py::const_),
+             R"pbdoc(
+               Get the maximum number of threads used by the race.
+
+               :Parameters: None
+               :return: An ``int``.
+             )pbdoc")
+        .def("number_of_runners",
+             &Race::number_of_runners,
+             R"pbdoc(
+               Returns the number of algorithms in the race.
+
+               :Parameters: None
+               :return: An ``int``.
+             )pbdoc")
+        .def("__len__", &Race::number_of_runners)
+        .def("runner",
+             &Race::runner,
+             py::arg("i"),
+             R"pbdoc(
+               Returns the algorithm with index ``i`` in the race.
+
+               :param i: the index.
+               :type i: int
+
+               :return: The algorithm.
+             )pbdoc")
+        .def("run",
+             &Race::run,
+             R"pbdoc(
+               Run the race until one of the algorithms finishes.
+
+               :Parameters: None
+               :return: The winner.
+             )pbdoc")
+        .def("run_for",
+             &Race::run_for,
+             py::arg("t"),
+             R"pbdoc(
+               Run the race until one of the algorithms finishes, or for the
+               specified amount of time.
+
+               :param t: the time to run for.
+               :type t: datetime.timedelta
+
+               :return: The winner, or ``None`` if there is no winner yet.
+             )pbdoc")
+        .def("run_until",
+             &Race::run_until,
+             py::arg("token"),
+             R"pbdoc(
+               Run the race until one of the algorithms finishes, or until
+               ``token`` is cancelled.
+
+               :param token: the cancellation token.
+               :type token: CancellationToken
+
+               :return: The winner, or ``None`` if there is no winner yet.
+             )pbdoc")
+        .def("finished",
+             &Race::finished,
+             R"pbdoc(
+               Check if the race has been won.
+
+               :Parameters: None
+               :return: A ``bool``.
+             )pbdoc")
+        .def("winner",
+             &Race::winner,
+             R"pbdoc(
+               Returns the winner of the race, or ``None`` if there is no
+               winner yet.
+
+               :Parameters: None
+               :return: The winner or ``None``.
+             )pbdoc")
+        .def("winner_index",
+             &Race::winner_index,
+             R"pbdoc(
+               Returns the index of the winner of the race, or ``None`` if
+               there is no winner yet.
+
+               :Parameters: None
+               :return: An ``int`` or ``None``.
+             )pbdoc");
+  }
+}  // namespace libsemigroups
@@ -0,0 +1,173 @@
+//
+// libsemigroups_pybind11
+// Copyright (C) 2023 James D. Mitchell
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+// This file contains helpers shared by the bindings of all the classes derived
+// from libsemigroups::Runner. The policy is that every entry point that can
+// run for a long time (run, run_for, run_until, enumerate, ...) releases the
+// GIL, so that several Python threads can drive separate Runners at once. The
+// GIL is only reacquired when calling back into Python.
+
+#ifndef SRC_RUNNER_HPP_
+#define SRC_RUNNER_HPP_
+
+// C std headers....
+#include <stdint.h>  // for int64_t
+
+// C++ stl headers....
+#include <atomic>      // for atomic
+#include <chrono>      // for nanoseconds, steady_clock, duration, ...
+#include <exception>   // for exception_ptr, current_exception, rethrow_...
+#include <functional>  // for function
+
+// pybind11....
+#include <pybind11/pybind11.h>  // for function, gil_scoped_release, dict, ...
+
+// libsemigroups_pybind11....
+#include "cancellation.hpp"  // for CancellationToken
+
+namespace libsemigroups {
+  namespace py = pybind11;
+
+  namespace libsemigroups_pybind11 {
+
+    // Returns the number of nanoseconds since some fixed point in time.
+    inline int64_t nanoseconds_now() {
+      return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                 std::chrono::steady_clock::now().time_since_epoch())
+          .count();
+    }
+
+    // Returns true if the calling thread, which must hold the GIL, is the
+    // main Python thread.
+    inline bool is_main_thread() {
+      py::module_ threading = py::module_::import("threading");
+      return threading.attr("current_thread")().is(
+          threading.attr("main_thread")());
+    }
+
+    // Run the Runner x until the nullary function f returns true (or x
+    // finishes), without holding the GIL. The GIL is only reacquired when f
+    // is actually called, and f is called at most once every poll nanoseconds
+    // (every time the Runner checks if it should stop if poll is 0). The
+    // function can be called from several threads (for example, by the Race
+    // in Congruence), which is why last is atomic, and why err is only
+    // accessed while holding the GIL. Any exception raised by f stops x, and
+    // is re-raised once x has stopped. If nogil is not empty, then x is also
+    // stopped as soon as nogil, which is called every time without the GIL,
+    // returns true.
+    template <typename T, typename F>
+    void run_until_with_gil(T&                       x,
+                            F&&                      f,
+                            std::chrono::nanoseconds poll,
+                            std::function<bool()>    nogil = nullptr) {
+      int64_t const         interval = poll.count();
+      std::atomic<int64_t>  last(nanoseconds_now() - interval);
+      std::exception_ptr    err;
+      std::function<bool()> pred = [&f, &last, &err, &nogil, interval]() {
+        if (nogil && nogil()) {
+          return true;
+        }
+        if (interval > 0) {
+          int64_t now  = nanoseconds_now();
+          int64_t prev = last.load();
+          if (now - prev < interval
+              || !last.compare_exchange_strong(prev, now)) {
+            return false;
+          }
+        }
+        py::gil_scoped_acquire gil;
+        if (err) {
+          return true;
+        }
+        try {
+          return static_cast<bool>(f());
+        } catch (...) {
+          err = std::current_exception();
+          return true;
+        }
+      };
+      {
+        py::gil_scoped_release release;
+        x.run_until(pred);
+      }
+      if (err) {
+        std::rethrow_exception(err);
+      }
+    }
+
+    // Run the Runner x until the Python nullary predicate func returns True
+    // (or x finishes), see run_until_with_gil.
+    template <typename T>
+    void run_until(T& x, py::function func, std::chrono::nanoseconds poll) {
+      run_until_with_gil(x, [&func]() { return func().cast<bool>(); }, poll);
+    }
+
+    // Run the Runner x until token is cancelled (or x finishes), without
+    // holding the GIL. Python signal handlers (such as the one installed by
+    // CancellationToken.cancel_on_signal, or the one raising
+    // KeyboardInterrupt) only run when the main thread calls
+    // PyErr_CheckSignals, and so the GIL is reacquired to do so at most once
+    // every signal_poll nanoseconds; in any other thread PyErr_CheckSignals
+    // does nothing, and the GIL is never reacquired. Any exception raised by
+    // a signal handler stops x, and is re-raised once x has stopped.
+    template <typename T>
+    void run_until_cancelled(T& x, CancellationToken const& token) {
+      std::function<bool()> pred = [token]() { return token.cancelled(); };
+      if (!is_main_thread()) {
+        py::gil_scoped_release release;
+        x.run_until(pred);
+        return;
+      }
+      int64_t const signal_poll = 50000000;  // 50ms
+      run_until_with_gil(
+          x,
+          [&token]() {
+            if (PyErr_CheckSignals() != 0) {
+              throw py::error_already_set();
+            }
+            return token.cancelled();
+          },
+          std::chrono::nanoseconds(signal_poll),
+          pred);
+    }
+
+    // Run the Runner x until it finishes, calling the Python function func
+    // with the dict returned by stats(x), and the elapsed time, at most once
+    // every interval nanoseconds, and once more when x stops. Since func is
+    // called in the thread running x, stats(x) reads the counters of x
+    // while they are not being modified. If func returns a true value, then
+    // x is stopped.
+    template <typename T, typename S>
+    void run_with_stats(T&                       x,
+                        py::function             func,
+                        std::chrono::nanoseconds interval,
+                        S&&                      stats) {
+      int64_t const start = nanoseconds_now();
+
+      auto call = [&x, &func, &stats, start]() {
+        py::dict d   = stats(x);
+        d["elapsed"] = static_cast<double>(nanoseconds_now() - start) / 1e9;
+        return py::bool_(func(d));
+      };
+      run_until_with_gil(x, call, interval);
+      call();
+    }
+  }  // namespace libsemigroups_pybind11
+}  // namespace libsemigroups
+
+#endif  // SRC_RUNNER_HPP_
@@ -18,27 +18,28 @@
 
 // TODO:
 // * iwyu
-// * Sims1::find_if
-// * Sims1::for_each
-// * Sims1Stats
-// * RepOrc
-// * MinimalRepOrc
 
 // C std headers....
 #include <stddef.h>  // for size_t
 #include <stdint.h>  // for int32_t, size_t
 
 // C++ stl headers....
-#include <initializer_list>  // for initializer_list
-#include <vector>            // for vector
+#include <condition_variable>  // for condition_variable
+#include <deque>               // for deque
+#include <exception>           // for exception_ptr, current_exception
+#include <initializer_list>    // for initializer_list
+#include <mutex>               // for mutex, unique_lock, lock_guard
+#include <thread>              // for thread
+#include <utility>             // for move
+#include <vector>              // for vector
 
 // libsemigroups....
 #include <libsemigroups/present.hpp>  // for Presentation
 #include <libsemigroups/sims1.hpp>    // for Sims1
 
 // pybind11....
-#include <pybind11/pybind11.h>  // for class_, init, module
-#include <pybind11/stl.h>
+#include <pybind11/pybind11.h>  // for class_, init, module, gil_scoped_...
+#include <pybind11/stl.h>       // for conversion of vector of ActionDigraph
 
 // libsemigroups_pybind11....
 #include "main.hpp"  // for init_sims1
@@ -46,196 +47,570 @@
 namespace py = pybind11;
 
 namespace libsemigroups {
-  void init_sims1(py::module& m) {
-    py::class_<Sims1Stats>(m, "Sims1Stats")
-        .def_readonly("max_pending", &Sims1Stats::max_pending)
-        .def_readonly("total_pending", &Sims1Stats::total_pending);
+  namespace {
+    using digraph_type = Sims1<size_t>::digraph_type;
+
+    // This class runs Sims1::find_if in a separate thread, which in turn uses
+    // Sims1::number_of_threads() worker threads, and collects the digraphs
+    // found into batches, which can be retrieved (in the order they are
+    // completed) using next. No more than max_pending batches are stored at
+    // any time, the worker threads are blocked until next is called if this
+    // is exceeded. None of the worker threads ever hold the GIL.
+    class Sims1Batches {
+     public:
+      Sims1Batches(Sims1<size_t> const& s,
+                   size_t               n,
+                   size_t               batch_size,
+                   size_t               max_pending)
+          : _batch_size(batch_size == 0 ? 1 : batch_size),
+            _batches(),
+            _current(),
+            _done(false),
+            _err(),
+            _max_pending(max_pending == 0 ? 1 : max_pending),
+            _mtx(),
+            _not_empty(),
+            _not_full(),
+            _sims(s),
+            _stop(false),
+            _thread() {
+        _thread = std::thread([this, n]() { run(n); });
+      }
+
+      Sims1Batches(Sims1Batches const&)            = delete;
+      Sims1Batches(Sims1Batches&&)                 = delete;
+      Sims1Batches& operator=(Sims1Batches const&) = delete;
+      Sims1Batches& operator=(Sims1Batches&&)      = delete;
+
+      ~Sims1Batches() {
+        stop();
+        py::gil_scoped_release release;
+        _thread.join();
+      }
+
+      // Returns the next batch, which is empty if there are no more digraphs,
+      // and rethrows any exception thrown by Sims1::find_if. Must be called
+      // while holding the GIL, which is released while waiting.
+      std::vector<digraph_type> next() {
+        std::vector<digraph_type> result;
+        {
+          py::gil_scoped_release       release;
+          std::unique_lock<std::mutex> lock(_mtx);
+          _not_empty.wait(lock,
+                          [this]() { return !_batches.empty() || _done; });
+          if (!_batches.empty()) {
+            result = std::move(_batches.front());
+            _batches.pop_front();
+            _not_full.notify_one();
+            return result;
+          }
+        }
+        if (_err) {
+          std::rethrow_exception(_err);
+        }
+        return result;
+      }
+
+      // Stop the search as soon as possible; the digraphs already found but
+      // not yet returned by next are discarded.
+      void stop() {
+        std::lock_guard<std::mutex> lock(_mtx);
+        _stop = true;
+        _batches.clear();
+        _not_full.notify_all();
+      }
+
+     private:
+      void run(size_t n) {
+        try {
+          _sims.find_if(n, [this](digraph_type const& ad) { return add(ad); });
+        } catch (...) {
+          _err = std::current_exception();
+        }
+        std::lock_guard<std::mutex> lock(_mtx);
+        if (!_current.empty() && !_stop) {
+          _batches.push_back(std::move(_current));
+        }
+        _done = true;
+        _not_empty.notify_all();
+      }
+
+      // Called by the worker threads for every digraph found, returns true
+      // if the search should stop.
+      bool add(digraph_type const& ad) {
+        std::unique_lock<std::mutex> lock(_mtx);
+        if (_stop) {
+          return true;
+        }
+        _current.push_back(ad);
+        if (_current.size() == _batch_size) {
+          _not_full.wait(lock, [this]() {
+            return _batches.size() < _max_pending || _stop;
+          });
+          if (_stop) {
+            return true;
+          }
+          _batches.push_back(std::move(_current));
+          _current.clear();
+          _not_empty.notify_one();
+        }
+        return false;
+      }
+
+      size_t const                          _batch_size;
+      std::deque<std::vector<digraph_type>> _batches;
+      std::vector<digraph_type>             _current;
+      bool                                  _done;
+      std::exception_ptr                    _err;
+      size_t const                          _max_pending;
+      std::mutex                            _mtx;
+      std::condition_variable               _not_empty;
+      std::condition_variable               _not_full;
+      Sims1<size_t>                         _sims;
+      bool                                  _stop;
+      std::thread                           _thread;
+    };
+
+    // Binds the settings shared by Sims1, RepOrc, and MinimalRepOrc, which
+    // are all derived from Sims1Settings.
+    template <typename T>
+    void bind_sims1_settings(py::class_<T>& x) {
+      x.def("number_of_threads",
+            py::overload_cast<size_t>(&T::number_of_threads),
+            py::arg("val"),
+            R"pbdoc(
+              Set the number of threads.
 
-    py::class_<Sims1<size_t>>(m, "Sims1")
-        .def(py::init<congruence_kind>())
-        .def(py::init<Sims1<size_t> const&>())
-        .def("number_of_threads",
-             py::overload_cast<size_t>(&Sims1<size_t>::number_of_threads),
-             py::arg("val"),
-             R"pbdoc(
-               Set the number of threads.
+              :Parameters: **val** (int) - the maximum number of threads to use.
 
-               :Parameters: **val** (int) - the maximum number of threads to use.
+              :Returns: ``self``.
+              )pbdoc")
+          .def("number_of_threads",
+               py::overload_cast<>(&T::number_of_threads, py::const_),
+               R"pbdoc(
+                 Returns the current number of threads.
 
-               :Returns: ``self``.
-               )pbdoc")
-        .def("number_of_threads",
-             py::overload_cast<>(&Sims1<size_t>::number_of_threads, py::const_),
-             R"pbdoc(
-               Returns the current number of threads.
+                 :Parameters: None
 
-               :Parameters: None
+                 :Returns: An ``int``.
+                 )pbdoc")
+          .def("report_interval",
+               py::overload_cast<>(&T::report_interval, py::const_),
+               R"pbdoc(
+                 Returns the current report interval.
+
+                 :Parameters: None
+
+                 :Returns: A ``int``.
+                 )pbdoc")
+          .def("report_interval",
+               py::overload_cast<size_t>(&T::report_interval),
+               py::arg("val"),
+               R"pbdoc(
+                 Set the report interval.
 
-               :Returns: An ``int``.
+                 :Parameters: **val** (int) - the new value for the report interval.
+
+                 :Returns: ``self``.
+                 )pbdoc")
+          .def(
+              "short_rules",
+              [](T const& s) { return s.short_rules(); },
+              R"pbdoc(
+                 Returns the current short rules.
+
+                 :Parameters: None
+
+                 :Returns: A ``Presentation``.
+               )pbdoc")
+          .def("short_rules",
+               &T::template short_rules<Presentation<word_type>>,
+               py::arg("p"),
+               R"pbdoc(
+                 Set the short rules.
+
+                 :Parameters: **p** (Presentation) - the presentation.
+
+                 :Returns: ``self``.
+                 )pbdoc")
+          .def("short_rules",
+               &T::template short_rules<Presentation<std::string>>,
+               py::arg("p"),
+               R"pbdoc(
+                 Set the short rules.
+
+                 :Parameters: **p** (Presentation) - the presentation.
+
+                 :Returns: ``self``.
+                 )pbdoc")
+          .def(
+              "long_rules",
+              [](T const& s) { return s.long_rules(); },
+              R"pbdoc(
+                 Returns the current long rules.
+
+                 :Parameters: None
+
+                 :Returns: A ``Presentation``.
+              )pbdoc")
+          .def("long_rules",
+               &T::template long_rules<Presentation<word_type>>,
+               py::arg("p"),
+               R"pbdoc(
+                 Set the long rules.
+
+                 :Parameters: **p** (Presentation) - the presentation.
+
+                 :Returns: ``self``.
+                 )pbdoc")
+          .def("long_rules",
+               &T::template long_rules<Presentation<std::string>>,
+               py::arg("p"),
+               R"pbdoc(
+                 Set the long rules.
+
+                 :Parameters: **p** (Presentation) - the presentation.
+
+                 :Returns: ``self``.
+                 )pbdoc")
+          .def("stats",
+               py::overload_cast<>(&T::stats, py::const_),
+               R"pbdoc(
+                 Returns the current stats object.
+
+                 :Parameters: None
+
+                 :Returns: A ``Sims1Stats`` object.
+                 )pbdoc")
+          .def("split_at",
+               &T::split_at,
+               py::arg("val"),
+               R"pbdoc(
+                 Split the rules in short_rules and long_rules.
+
+                 :param val: the relation to split at.
+                 :type val: int
+
+                 :return: (None)
+                 )pbdoc")
+          .def("long_rule_length",
+               &T::long_rule_length,
+               py::arg("val"),
+               R"pbdoc(
+                 Define the long rule length.
+
+                 :param val: the value of the long rule length.
+                 :type val: int
+
+                 :return: ``self``.
+                 )pbdoc")
+          .def(
+              "extra",
+              [](T const& s) { return s.extra(); },
+              R"pbdoc(
+                 Returns the additional defining pairs.
+
+                 :Parameters: None
+
+                 :Returns: A ``Presentation``.
                )pbdoc")
-        .def("report_interval",
-             py::overload_cast<>(&Sims1<size_t>::report_interval, py::const_),
+          .def("extra",
+               &T::template extra<Presentation<word_type>>,
+               py::arg("p"),
+               R"pbdoc(
+                 Set the extra rules.
+
+                 :Parameters: **p** (Presentation) - the presentation.
+
+                 :Returns: ``self``.
+                 )pbdoc")
+          .def("extra",
+               &T::template extra<Presentation<std::string>>,
+               py::arg("p"),
+               R"pbdoc(
+                 Set the extra rules.
+
+                 :Parameters: **p** (Presentation) - the presentation.
+
+                 :Returns: ``self``.
+                 )pbdoc");
+    }
+  }  // namespace
+
+  void init_sims1(py::module& m) {
+    py::class_<Sims1Batches>(m, "Sims1Batches")
+        .def("__iter__", [](py::object self) { return self; })
+        .def("__next__",
+             [](Sims1Batches& b) {
+               auto result = b.next();
+               if (result.empty()) {
+                 throw py::stop_iteration();
+               }
+               return result;
+             })
+        .def("stop",
+             &Sims1Batches::stop,
              R"pbdoc(
-               Returns the current report interval.
+               Stop the search as soon as possible.
+
+               Any batches already found but not yet returned are discarded,
+               and the iterator is exhausted after the next call to
+               ``next``.
 
                :Parameters: None
+               :Returns: None
+               )pbdoc");
 
-               :Returns: A ``int``.
-               )pbdoc")
-        .def("report_interval",
-             py::overload_cast<size_t>(&Sims1<size_t>::report_interval),
-             py::arg("val"),
-             R"pbdoc(
-               Set the report interval.
+    py::class_<Sims1Stats>(m, "Sims1Stats")
+        .def_readonly("max_pending", &Sims1Stats::max_pending)
+        .def_readonly("total_pending", &Sims1Stats::total_pending);
 
-               :Parameters: **val** (int) - the new value for the report interval.
+    py::class_<Sims1<size_t>> sims1(m, "Sims1");
+    bind_sims1_settings(sims1);
 
-               :Returns: ``self``.
-               )pbdoc")
+    sims1.def(py::init<congruence_kind>())
+        .def(py::init<Sims1<size_t> const&>())
         .def(
-            "short_rules",
-            [](Sims1<size_t> const& s) { return s.short_rules(); },
+            "iterator",
+            [](Sims1<size_t> const& s, size_t n) {
+              return py::make_iterator(s.cbegin(n), s.cend(n));
+            },
             R"pbdoc(
-               Returns the current short rules.
+               Returns an iterator pointing at the first congruence.
 
-               :Parameters: None
+               :param n: the maximum number of classes in a congruence.
+               :type n: int
 
-               :Returns: A ``Presentation``.
-             )pbdoc")
-        .def("short_rules",
-             &Sims1<size_t>::short_rules<Presentation<word_type>>,
-             py::arg("p"),
-             R"pbdoc(
-               Set the short rules.
+               :return: An iterator pointing to an ActionDigraph with at most n nodes.
+               )pbdoc")
+        .def(
+            "batches",
+            [](Sims1<size_t> const& s,
+               size_t               n,
+               size_t               batch_size,
+               size_t               max_pending) {
+              return new Sims1Batches(s, n, batch_size, max_pending);
+            },
+            py::arg("n"),
+            py::arg("batch_size")  = 1024,
+            py::arg("max_pending") = 4,
+            R"pbdoc(
+               Returns an iterator yielding lists of congruences.
 
-               :Parameters: **p** (Presentation) - the presentation.
+               The congruences are found by :py:meth:`number_of_threads`
+               threads that do not hold the GIL, and are returned in lists of
+               (at most) ``batch_size`` digraphs. At most ``max_pending``
+               lists are stored waiting to be returned, and the search is
+               paused until the next list is requested if this number is
+               reached. If there is more than one thread, then the order of
+               the congruences is not deterministic.
 
-               :Returns: ``self``.
+               :param n: the maximum number of classes in a congruence.
+               :type n: int
+               :param batch_size: the maximum number of digraphs in a list.
+               :type batch_size: int
+               :param max_pending: the maximum number of lists stored.
+               :type max_pending: int
+
+               :return: An iterator yielding lists of ActionDigraph objects.
                )pbdoc")
-        .def("short_rules",
-             &Sims1<size_t>::short_rules<Presentation<std::string>>,
-             py::arg("p"),
-             R"pbdoc(
-               Set the short rules.
+        .def(
+            "for_each",
+            [](Sims1<size_t> const& s,
+               size_t               n,
+               py::function         func,
+               size_t               batch_size,
+               size_t               max_pending) {
+              Sims1Batches batches(s, n, batch_size, max_pending);
+              for (auto batch = batches.next(); !batch.empty();
+                   batch      = batches.next()) {
+                py::object stop = func(std::move(batch));
+                if (!stop.is_none() && stop.cast<bool>()) {
+                  batches.stop();
+                  return;
+                }
+              }
+            },
+            py::arg("n"),
+            py::arg("func"),
+            py::arg("batch_size")  = 1024,
+            py::arg("max_pending") = 4,
+            R"pbdoc(
+               Call a function on every congruence, in batches.
 
-               :Parameters: **p** (Presentation) - the presentation.
+               The function ``func`` is called with every list yielded by
+               :py:meth:`batches` ``(n, batch_size, max_pending)``, in the
+               thread that called this function. If ``func`` returns
+               ``True``, then the search is stopped.
 
-               :Returns: ``self``.
+               :param n: the maximum number of classes in a congruence.
+               :type n: int
+               :param func: called with each list of ActionDigraph objects.
+               :type func: Callable[[List[ActionDigraph]], Optional[bool]]
+               :param batch_size: the maximum number of digraphs in a list.
+               :type batch_size: int
+               :param max_pending: the maximum number of lists stored.
+               :type max_pending: int
+
+               :return: None
                )pbdoc")
         .def(
-            "long_rules",
-            [](Sims1<size_t> const& s) { return s.long_rules(); },
+            "find_if",
+            [](Sims1<size_t> const& s,
+               size_t               n,
+               py::function         pred,
+               size_t               batch_size,
+               size_t               max_pending) {
+              Sims1Batches batches(s, n, batch_size, max_pending);
+              for (auto batch = batches.next(); !batch.empty();
+                   batch      = batches.next()) {
+                for (auto& ad : batch) {
+                  if (pred(ad).cast<bool>()) {
+                    batches.stop();
+                    return std::move(ad);
+                  }
+                }
+              }
+              return digraph_type(0, 0);
+            },
+            py::arg("n"),
+            py::arg("pred"),
+            py::arg("batch_size")  = 1024,
+            py::arg("max_pending") = 4,
             R"pbdoc(
-               Returns the current long rules.
+               Returns a congruence satisfying a predicate.
 
-               :Parameters: None
+               The search is performed as in :py:meth:`batches`, and the
+               unary predicate ``pred`` is called, in the thread that called
+               this function, on the congruences found until it returns
+               ``True``. If there is more than one thread, then the
+               congruence returned is not necessarily the first one in the
+               order of :py:meth:`iterator`.
 
-               :Returns: A ``Presentation``.
-            )pbdoc")
-        .def("long_rules",
-             &Sims1<size_t>::long_rules<Presentation<word_type>>,
-             py::arg("p"),
+               :param n: the maximum number of classes in a congruence.
+               :type n: int
+               :param pred: the predicate.
+               :type pred: Callable[[ActionDigraph], bool]
+               :param batch_size: the maximum number of digraphs in a list.
+               :type batch_size: int
+               :param max_pending: the maximum number of lists stored.
+               :type max_pending: int
+
+               :return:
+                 An ActionDigraph satisfying ``pred``, or with ``0`` nodes if
+                 there is no such congruence.
+               )pbdoc")
+        .def("number_of_congruences",
+             &Sims1<size_t>::number_of_congruences,
+             py::arg("n"),
              R"pbdoc(
-               Set the long rules.
+               Returns the number of one-sided congruences with up to a given number of classes.
 
-               :Parameters: **p** (Presentation) - the presentation.
+               :param n: the maximum number of congruence classes.
+               :type n: int
 
-               :Returns: ``self``.
-               )pbdoc")
-        .def("long_rules",
-             &Sims1<size_t>::long_rules<Presentation<std::string>>,
-             py::arg("p"),
-             R"pbdoc(
-               Set the long rules.
+               :return: A value of type uint64_t.
+               )pbdoc");
 
-               :Parameters: **p** (Presentation) - the presentation.
+    py::class_<RepOrc> rep_orc(m, "RepOrc");
+    bind_sims1_settings(rep_orc);
 
-               :Returns: ``self``.
-               )pbdoc")
-        .def("stats",
-             py::overload_cast<>(&Sims1<size_t>::stats, py::const_),
+    rep_orc.def(py::init<>())
+        .def(py::init<RepOrc const&>())
+        .def("min_nodes",
+             py::overload_cast<size_t>(&RepOrc::min_nodes),
+             py::arg("val"),
              R"pbdoc(
-               Returns the current stats object.
+               Set the minimum number of nodes.
 
-               :Parameters: None
+               :Parameters: **val** (int) - the minimum number of nodes.
 
-               :Returns: A ``Sims1Stats`` object.
+               :Returns: ``self``.
                )pbdoc")
-        .def("split_at",
-             &Sims1<size_t>::split_at,
+        .def("max_nodes",
+             py::overload_cast<size_t>(&RepOrc::max_nodes),
              py::arg("val"),
              R"pbdoc(
-               Split the rules in short_rules and long_rules.
+               Set the maximum number of nodes.
 
-               :param val: the relation to split at.
-               :type val: int
+               :Parameters: **val** (int) - the maximum number of nodes.
 
-               :return: (None)
+               :Returns: ``self``.
                )pbdoc")
-        .def("long_rule_length",
-             &Sims1<size_t>::long_rule_length,
+        .def("target_size",
+             py::overload_cast<size_t>(&RepOrc::target_size),
              py::arg("val"),
              R"pbdoc(
-               Define the long rule length.
+               Set the target size.
 
-               :param val: the value of the long rule length.
-               :type val: int
+               :Parameters: **val** (int) - the size of the semigroup or
+                            monoid defined by the short and long rules.
 
-               :return: ``self``.
+               :Returns: ``self``.
                )pbdoc")
-        .def(
-            "extra",
-            [](Sims1<size_t> const& s) { return s.extra(); },
-            R"pbdoc(
-               Returns the additional defining pairs.
+        .def("digraph",
+             &RepOrc::digraph<size_t>,
+             py::call_guard<py::gil_scoped_release>(),
+             R"pbdoc(
+               Returns a digraph representing a right congruence.
+
+               This function attempts to find a right congruence, represented
+               as an :py:class:`ActionDigraph`, of the semigroup or monoid
+               defined by the short and long rules, with at least
+               ``min_nodes`` and at most ``max_nodes`` nodes, such that the
+               action of the semigroup or monoid on the nodes is faithful and
+               generates a semigroup of size ``target_size``. The search uses
+               :py:meth:`number_of_threads` threads, and the GIL is released
+               while it runs. The search is performed by a :py:class:`Sims1`
+               object internal to libsemigroups, and so it does not update
+               :py:meth:`stats`.
 
                :Parameters: None
 
-               :Returns: A ``Presentation``.
-             )pbdoc")
-        .def("extra",
-             &Sims1<size_t>::extra<Presentation<word_type>>,
-             py::arg("p"),
-             R"pbdoc(
-               Set the extra rules.
+               :Returns:
+                 An :py:class:`ActionDigraph`, which has ``0`` nodes if there
+                 is no such right congruence.
+               )pbdoc");
 
-               :Parameters: **p** (Presentation) - the presentation.
+    py::class_<MinimalRepOrc> minimal_rep_orc(m, "MinimalRepOrc");
+    bind_sims1_settings(minimal_rep_orc);
 
-               :Returns: ``self``.
-               )pbdoc")
-        .def("extra",
-             &Sims1<size_t>::extra<Presentation<std::string>>,
-             py::arg("p"),
+    minimal_rep_orc.def(py::init<>())
+        .def(py::init<MinimalRepOrc const&>())
+        .def("target_size",
+             py::overload_cast<size_t>(&MinimalRepOrc::target_size),
+             py::arg("val"),
              R"pbdoc(
-               Set the extra rules.
+               Set the target size.
 
-               :Parameters: **p** (Presentation) - the presentation.
+               :Parameters: **val** (int) - the size of the semigroup or
+                            monoid defined by the short and long rules.
 
                :Returns: ``self``.
                )pbdoc")
-        .def(
-            "iterator",
-            [](Sims1<size_t> const& s, size_t n) {
-              return py::make_iterator(s.cbegin(n), s.cend(n));
-            },
-            R"pbdoc(
-               Returns an iterator pointing at the first congruence.
-
-               :param n: the maximum number of classes in a congruence.
-               :type n: int
-
-               :return: An iterator pointing to an ActionDigraph with at most n nodes.
-               )pbdoc")
-        .def("number_of_congruences",
-             &Sims1<size_t>::number_of_congruences,
-             py::arg("n"),
+        .def("digraph",
+             &MinimalRepOrc::digraph<size_t>,
+             py::call_guard<py::gil_scoped_release>(),
              R"pbdoc(
-               Returns the number of one-sided congruences with up to a given number of classes.
+               Returns a digraph representing a minimal right congruence.
+
+               This function attempts to find a right congruence, with the
+               minimum possible number of nodes, represented as an
+               :py:class:`ActionDigraph`, of the semigroup or monoid defined
+               by the short and long rules, such that the action of the
+               semigroup or monoid on the nodes is faithful and generates a
+               semigroup of size ``target_size``. In other words, this
+               function returns a minimal degree transformation
+               representation. The search uses :py:meth:`number_of_threads`
+               threads, and the GIL is released while it runs. As for
+               :py:meth:`RepOrc.digraph`, the search does not update
+               :py:meth:`stats`.
 
-               :param n: the maximum number of congruence classes.
-               :type n: int
+               :Parameters: None
 
-               :return: A value of type uint64_t.
+               :Returns:
+                 An :py:class:`ActionDigraph`, which has ``0`` nodes if there
+                 is no such right congruence.
                )pbdoc");
   }
 }  // namespace libsemigroups
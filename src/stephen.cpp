@@ -16,23 +16,118 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 //
 
+// C std headers....
+#include <stddef.h>  // for size_t
+
+// C++ stl headers....
+#include <vector>  // for vector
+
 // libsemigroups....
-#include <libsemigroups/constants.hpp>  // for POSITIVE_INFINITY
-#include <libsemigroups/stephen.hpp>    // for Stephen
+#include <libsemigroups/constants.hpp>       // for POSITIVE_INFINITY
+#include <libsemigroups/digraph-helper.hpp>  // for follow_path
+#include <libsemigroups/stephen.hpp>         // for Stephen
+#include <libsemigroups/types.hpp>           // for word_type
 
 // pybind11....
 #include <pybind11/chrono.h>
 #include <pybind11/functional.h>
+#include <pybind11/numpy.h>     // for array_t
 #include <pybind11/pybind11.h>  // for class_, init, make_iterator, module
 #include <pybind11/stl.h>
 
 // libsemigroups_pybind11....
 #include "doc-strings.hpp"  // for doc_strings
 #include "main.hpp"         // for init_stephen
+#include "numpy.hpp"        // for unflatten_words
+#include "parallel.hpp"     // for parallel_for
+#include "path-chunks.hpp"  // for make_path_chunks
+#include "runner.hpp"       // for run_until, run_until_cancelled
 
 namespace py = pybind11;
 
 namespace libsemigroups {
+  namespace {
+    using libsemigroups_pybind11::unflatten_words;
+
+    // Returns the array whose i-th entry is true if and only if words[i] is
+    // accepted by s (if accept is true), or is a left factor of the word of s
+    // (if accept is false). The word graph of s is computed once for all of
+    // the words, with the GIL released, and is then only read, by at most
+    // max_threads threads.
+    py::array_t<bool> follow_paths(Stephen&                      s,
+                                   std::vector<word_type> const& words,
+                                   bool                          accept,
+                                   size_t                        max_threads) {
+      py::array_t<bool> result(words.size());
+      bool*             out = result.mutable_data();
+      {
+        py::gil_scoped_release release;
+        s.run();
+        auto const& wg = s.word_graph();
+        if (accept) {
+          size_t const target = s.accept_state();
+          libsemigroups_pybind11::parallel_for(
+              words.size(), max_threads, [&wg, &words, target, out](size_t i) {
+                out[i] = action_digraph_helper::follow_path(wg, 0, words[i])
+                         == target;
+              });
+        } else {
+          libsemigroups_pybind11::parallel_for(
+              words.size(), max_threads, [&wg, &words, out](size_t i) {
+                out[i] = action_digraph_helper::follow_path(wg, 0, words[i])
+                         != UNDEFINED;
+              });
+        }
+      }
+      return result;
+    }
+
+    // Adds the overloads of the function name, for words given as lists and
+    // in the flat format (see unflatten_words), which return the result of
+    // follow_paths.
+    void def_follow_paths(py::module& m,
+                          char const* name,
+                          bool        accept,
+                          char const* doc) {
+      m.def(
+          name,
+          [accept](Stephen&                      s,
+                   std::vector<word_type> const& words,
+                   size_t                        max_threads) {
+            return follow_paths(s, words, accept, max_threads);
+          },
+          py::arg("s"),
+          py::arg("words"),
+          py::arg("max_threads") = 1,
+          doc);
+      m.def(
+          name,
+          [accept](Stephen&          s,
+                   py::object const& offsets,
+                   py::object const& letters,
+                   size_t            max_threads) {
+            return follow_paths(
+                s, unflatten_words(offsets, letters), accept, max_threads);
+          },
+          py::arg("s"),
+          py::arg("offsets"),
+          py::arg("letters"),
+          py::arg("max_threads") = 1,
+          R"pbdoc(
+            As above, but the words are given in a flat format, where the
+            ``i``-th word is ``letters[offsets[i]:offsets[i + 1]]``.
+
+            :param s: the :py:class:`Stephen` instance.
+            :type s: Stephen
+            :param offsets: the offsets of the words in ``letters``.
+            :type offsets: numpy.ndarray
+            :param letters: the letters of the words.
+            :type letters: numpy.ndarray
+            :param max_threads: as above.
+            :type max_threads: int
+          )pbdoc");
+    }
+  }  // namespace
 
   void init_stephen(py::module& m) {
     py::class_<Stephen>(m, "Stephen")
@@ -185,15 +280,24 @@ namespace libsemigroups {
              &Stephen::stopped_by_predicate,
              runner_doc_strings::stopped_by_predicate)
         .def("kill", &Stephen::kill, runner_doc_strings::kill)
-        .def("run", &Stephen::run, runner_doc_strings::run)
+        .def("run",
+             &Stephen::run,
+             py::call_guard<py::gil_scoped_release>(),
+             runner_doc_strings::run)
         .def("run_for",
              (void(Stephen::*)(std::chrono::nanoseconds)) & Runner::run_for,
              py::arg("t"),
+             py::call_guard<py::gil_scoped_release>(),
              runner_doc_strings::run_for)
         .def("run_until",
-             (void(Stephen::*)(std::function<bool()>&)) & Runner::run_until,
+             &libsemigroups_pybind11::run_until<Stephen>,
              py::arg("func"),
+             py::arg("poll") = std::chrono::nanoseconds(0),
              runner_doc_strings::run_until)
+        .def("run_until",
+             &libsemigroups_pybind11::run_until_cancelled<Stephen>,
+             py::arg("token"),
+             runner_doc_strings::run_until_cancelled)
         .def("report_every",
              (void(Stephen::*)(std::chrono::nanoseconds))
                  & Runner::report_every,
@@ -358,6 +462,181 @@ namespace libsemigroups {
             another word in a finitely presented semigroup is undecidable in
             general, and this function may never terminate.
         )pbdoc");
+    def_follow_paths(m,
+                     "accepts_many",
+                     true,
+                     R"pbdoc(
+          Check if each of many words is equivalent to :py:meth:`Stephen.word`.
+
+          This function triggers the algorithm implemented in this class (if it
+          hasn't been triggered already), with the GIL released, and then
+          follows the path labelled by every word from the initial node of the
+          same word graph, checking if it ends at the accept state, as
+          :py:func:`accepts` does.
+
+          :param s: the :py:class:`Stephen` instance.
+          :type s: Stephen
+          :param words: the input words.
+          :type words: List[List[int]]
+          :param max_threads:
+            the maximum number of threads to use once the word graph has been
+            computed, ``0`` means as many as the hardware supports (default:
+            ``1``).
+          :type max_threads: int
+
+          :returns:
+            A ``numpy.ndarray`` of ``bool`` whose ``i``-th entry is ``True``
+            if and only if ``words[i]`` is equivalent to
+            :py:meth:`Stephen.word`.
+
+          :raises RuntimeError:
+            if no presentation was set at the construction of ``s`` or with
+            :py:meth:`Stephen.init`, or if any word contains a letter not in
+            the alphabet of :py:meth:`Stephen.presentation`.
+
+          :warning:
+            The problem of determining whether two words are equal in a
+            finitely presented semigroup is undecidable in general, and this
+            function may never terminate.
+        )pbdoc");
+    def_follow_paths(m,
+                     "is_left_factor_many",
+                     false,
+                     R"pbdoc(
+          Check if each of many words is a left factor of
+          :py:meth:`Stephen.word`.
+
+          This function triggers the algorithm implemented in this class (if it
+          hasn't been triggered already), with the GIL released, and then
+          checks if the path labelled by every word from the initial node of
+          the same word graph exists, as :py:func:`is_left_factor` does.
+
+          :param s: the :py:class:`Stephen` instance.
+          :type s: Stephen
+          :param words: the input words.
+          :type words: List[List[int]]
+          :param max_threads:
+            the maximum number of threads to use once the word graph has been
+            computed (default: ``1``).
+          :type max_threads: int
+
+          :returns:
+            A ``numpy.ndarray`` of ``bool`` whose ``i``-th entry is ``True``
+            if and only if ``words[i]`` is a left factor of
+            :py:meth:`Stephen.word`.
+
+          :raises RuntimeError:
+            if no presentation was set at the construction of ``s`` or with
+            :py:meth:`Stephen.init`, or if any word contains a letter not in
+            the alphabet of :py:meth:`Stephen.presentation`.
+        )pbdoc");
+    m.def(
+        "words_accepted_chunks",
+        [](Stephen& s, size_t min, size_t max, size_t chunk_size) {
+          {
+            py::gil_scoped_release release;
+            s.run();
+          }
+          return libsemigroups_pybind11::make_path_chunks(
+              stephen::cbegin_words_accepted(s, min, max),
+              stephen::cend_words_accepted(s),
+              chunk_size);
+        },
+        py::arg("s"),
+        py::arg("min")        = 0,
+        py::arg("max")        = static_cast<size_t>(POSITIVE_INFINITY),
+        py::arg("chunk_size") = 4096,
+        py::keep_alive<0, 1>(),
+        R"pbdoc(
+          Returns an iterator yielding chunks of the words equivalent to
+          :py:meth:`Stephen.word` in short-lex order.
+
+          Each chunk is a tuple ``(offsets, letters)`` of ``numpy.ndarray``
+          such that the ``i``-th word in the chunk is
+          ``letters[offsets[i]:offsets[i + 1]]``. This is equivalent to, but
+          much faster than, :py:func:`words_accepted`. The algorithm
+          implemented in this class is triggered (if it hasn't been triggered
+          already) with the GIL released.
+
+          :param s:
+            the :py:class:`Stephen` instance
+          :type s:
+            Stephen
+          :param min:
+            the minimum length of an equivalent word (default: ``0``)
+          :type min:
+            int
+          :param max:
+            the maximum length of an equivalent word (default:
+            :py:class:`POSITIVE_INFINITY`)
+          :type max:
+            int
+          :param chunk_size:
+            the maximum number of words in a chunk (default: ``4096``)
+          :type chunk_size:
+            int
+
+          :returns: An iterator.
+
+          :raises RuntimeError:
+            if no presentation was set at the construction of ``s`` or with
+            :py:meth:`Stephen.init`.
+
+          .. seealso::
+            :py:meth:`ActionDigraph.pstislo_chunks`.
+        )pbdoc");
+    m.def(
+        "left_factors_chunks",
+        [](Stephen& s, size_t min, size_t max, size_t chunk_size) {
+          {
+            py::gil_scoped_release release;
+            s.run();
+          }
+          return libsemigroups_pybind11::make_path_chunks(
+              stephen::cbegin_left_factors(s, min, max),
+              stephen::cend_left_factors(s),
+              chunk_size);
+        },
+        py::arg("s"),
+        py::arg("min")        = 0,
+        py::arg("max")        = static_cast<size_t>(POSITIVE_INFINITY),
+        py::arg("chunk_size") = 4096,
+        py::keep_alive<0, 1>(),
+        R"pbdoc(
+          Returns an iterator yielding chunks of the left factors of
+          :py:meth:`Stephen.word` in short-lex order.
+
+          See :py:func:`words_accepted_chunks` for the format of the chunks.
+          This is equivalent to, but much faster than,
+          :py:func:`left_factors`.
+
+          :param s:
+            the :py:class:`Stephen` instance
+          :type s:
+            Stephen
+          :param min:
+            the minimum length of a left factor (default: ``0``)
+          :type min:
+            int
+          :param max:
+            the maximum length of a left factor (default:
+            :py:class:`POSITIVE_INFINITY`)
+          :type max:
+            int
+          :param chunk_size:
+            the maximum number of words in a chunk (default: ``4096``)
+          :type chunk_size:
+            int
+
+          :returns: An iterator.
+
+          :raises RuntimeError:
+            if no presentation was set at the construction of ``s`` or with
+            :py:meth:`Stephen.init`.
+
+          .. seealso::
+            :py:meth:`ActionDigraph.pislo_chunks`.
+        )pbdoc");
     m.def("number_of_words_accepted",
           &stephen::number_of_words_accepted,
           py::arg("s"),
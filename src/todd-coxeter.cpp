@@ -16,19 +16,23 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 //
 
+// C std headers....
+#include <stddef.h>  // for size_t
+
 // C++ stl headers....
 #include <array>             // for array
-#include <chrono>            // for nanoseconds
+#include <chrono>            // for nanoseconds, seconds
 #include <functional>        // for __base, function
 #include <initializer_list>  // for initializer_list
 #include <iosfwd>            // for string
-#include <memory>            // for allocator, shared_ptr
+#include <memory>            // for allocator, shared_ptr, make_unique
 #include <string>            // for operator+, char_traits, basic_st...
 #include <vector>            // for vector
 
 // libsemigroups....
 #include <libsemigroups/cong-intf.hpp>  // for congruence_kind
 #include <libsemigroups/constants.hpp>  // for operator==, UNDEFINED, Undefined
+#include <libsemigroups/exception.hpp>  // for LIBSEMIGROUPS_EXCEPTION
 #include <libsemigroups/knuth-bendix.hpp>  // for KnuthBendix
 #include <libsemigroups/runner.hpp>        // for Runner
 #include <libsemigroups/string.hpp>        // for to_string
@@ -38,12 +42,16 @@
 // pybind11....
 #include <pybind11/chrono.h>
 #include <pybind11/functional.h>
+#include <pybind11/numpy.h>     // for array_t
 #include <pybind11/pybind11.h>  // for class_, enum_, init, make_iterator
 #include <pybind11/stl.h>
 
 // libsemigroups_pybind11....
+#include "cong-intf.hpp"    // for bind_cong_intf_batch
 #include "doc-strings.hpp"  // for add_pair, class_index_to_word
 #include "main.hpp"         // for init_todd_coxeter
+#include "numpy.hpp"        // for input_array
+#include "runner.hpp"       // for run_until, run_with_stats
 
 namespace libsemigroups {
   class FroidurePinBase;
@@ -57,6 +65,86 @@ namespace libsemigroups {
 namespace py = pybind11;
 
 namespace libsemigroups {
+  namespace {
+    py::dict todd_coxeter_stats(congruence::ToddCoxeter const& tc) {
+      py::dict result;
+      result["active_cosets"]  = tc.number_of_cosets_active();
+      result["defined_cosets"] = tc.number_of_cosets_defined();
+      result["killed_cosets"]  = tc.number_of_cosets_killed();
+      result["finished"]       = tc.finished();
+      return result;
+    }
+
+    // Returns the coset table of tc, after running tc to completion and
+    // standardizing it, in the format accepted by prefill: row 0 is the
+    // coset of the empty word, and row i + 1 is the coset of the class with
+    // index i. Since libsemigroups does not expose the coset table, it is
+    // recovered by tracing the normal forms of the classes.
+    py::array_t<size_t> todd_coxeter_table(congruence::ToddCoxeter& tc) {
+      size_t const m = tc.number_of_generators();
+      size_t       n;
+      {
+        py::gil_scoped_release release;
+        n = tc.number_of_classes();
+      }
+      py::array_t<size_t> result({n + 1, m});
+      size_t*             out = result.mutable_data();
+      {
+        py::gil_scoped_release release;
+        tc.standardize(congruence::ToddCoxeter::order::shortlex);
+        bool const left = (tc.kind() == congruence_kind::left);
+        for (size_t a = 0; a < m; ++a) {
+          out[a] = tc.word_to_class_index({a}) + 1;
+        }
+        word_type w;
+        for (size_t i = 0; i < n; ++i) {
+          w = tc.class_index_to_word(i);
+          if (left) {
+            w.insert(w.begin(), 0);
+          } else {
+            w.push_back(0);
+          }
+          letter_type& last = left ? w.front() : w.back();
+          for (size_t a = 0; a < m; ++a) {
+            last                 = a;
+            out[(i + 1) * m + a] = tc.word_to_class_index(w) + 1;
+          }
+        }
+      }
+      return result;
+    }
+
+    // Runs tc to completion and standardizes it, after which
+    // word_to_class_index only reads tc, since it would otherwise
+    // standardize tc itself.
+    void prepare_for_batch(congruence::ToddCoxeter& tc) {
+      tc.run();
+      if (!tc.is_standardized()) {
+        tc.standardize(congruence::ToddCoxeter::order::shortlex);
+      }
+    }
+
+    void todd_coxeter_prefill(
+        congruence::ToddCoxeter&                            tc,
+        libsemigroups_pybind11::input_array<size_t> const& table) {
+      if (table.ndim() != 2) {
+        LIBSEMIGROUPS_EXCEPTION("expected a 2-dimensional array, found %llu "
+                                "dimensions",
+                                static_cast<unsigned long long>(table.ndim()));
+      }
+      size_t const                         nr_rows = table.shape(0);
+      size_t const                         nr_cols = table.shape(1);
+      size_t const*                        in      = table.data();
+      congruence::ToddCoxeter::table_type t(nr_cols, nr_rows);
+      for (size_t i = 0; i < nr_rows; ++i) {
+        for (size_t a = 0; a < nr_cols; ++a) {
+          t.set(i, a, in[i * nr_cols + a]);
+        }
+      }
+      tc.prefill(t);
+    }
+  }  // namespace
+
   void init_todd_coxeter(py::module& m) {
     using sort_function_type
         = std::function<bool(word_type const&, word_type const&)>;
@@ -416,17 +504,53 @@ namespace libsemigroups {
              &congruence::ToddCoxeter::report_why_we_stopped,
              runner_doc_strings::report_why_we_stopped)
         .def("kill", &congruence::ToddCoxeter::kill, runner_doc_strings::kill)
-        .def("run", &congruence::ToddCoxeter::run, runner_doc_strings::run)
+        .def("run",
+             &congruence::ToddCoxeter::run,
+             py::call_guard<py::gil_scoped_release>(),
+             runner_doc_strings::run)
         .def("run_for",
              (void(congruence::ToddCoxeter::*)(std::chrono::nanoseconds))
                  & Runner::run_for,
              py::arg("t"),
+             py::call_guard<py::gil_scoped_release>(),
              runner_doc_strings::run_for)
         .def("run_until",
-             (void(congruence::ToddCoxeter::*)(std::function<bool()>&))
-                 & Runner::run_until,
+             &libsemigroups_pybind11::run_until<congruence::ToddCoxeter>,
              py::arg("func"),
+             py::arg("poll") = std::chrono::nanoseconds(0),
              runner_doc_strings::run_until)
+        .def("run_until",
+             &libsemigroups_pybind11::run_until_cancelled<
+                 congruence::ToddCoxeter>,
+             py::arg("token"),
+             runner_doc_strings::run_until_cancelled)
+        .def(
+            "run_with_stats",
+            [](congruence::ToddCoxeter& tc,
+               py::function             func,
+               std::chrono::nanoseconds interval) {
+              libsemigroups_pybind11::run_with_stats(
+                  tc, func, interval, &todd_coxeter_stats);
+            },
+            py::arg("func"),
+            py::arg("interval") = std::chrono::seconds(1),
+            runner_doc_strings::run_with_stats)
+        .def("stats",
+             &todd_coxeter_stats,
+             R"pbdoc(
+               Returns a dictionary containing the current values of some
+               counters.
+
+               The keys are ``"active_cosets"``, ``"defined_cosets"``, and
+               ``"killed_cosets"``, the number of cosets that are active, that
+               have been defined, and that have been killed, respectively, and
+               ``"finished"``. These values are only approximate if this is
+               running in another thread; use :py:meth:`run_with_stats` to
+               monitor a run.
+
+               :Parameters: None
+               :return: A ``dict``.
+             )pbdoc")
         .def("less",
              &congruence::ToddCoxeter::less,
              py::arg("u"),
@@ -561,6 +685,77 @@ namespace libsemigroups {
               Returns an iterator to the normal forms of the congruence
               represented by an instance of :py:class:`ToddCoxeter`.
             )pbdoc")
+        .def("table",
+             &todd_coxeter_table,
+             R"pbdoc(
+               Returns the coset table.
+
+               This function runs the congruence enumeration to completion,
+               and then standardizes it with respect to the short-lex order.
+               The returned value is a ``numpy.ndarray`` with
+               :py:meth:`number_of_classes` plus one rows, and
+               :py:meth:`number_of_generators` columns. Row ``0`` corresponds
+               to the empty word, and row ``i + 1`` to the class with index
+               ``i``. The entry in row ``r`` and column ``a`` is the row
+               obtained by multiplying (on the right for right and two-sided
+               congruences, and on the left for left congruences) the
+               class corresponding to row ``r`` by the generator ``a``.
+               This is the format of the argument of :py:meth:`prefill`.
+
+               :Parameters: None
+               :return: A ``numpy.ndarray``.
+             )pbdoc")
+        .def("prefill",
+             &todd_coxeter_prefill,
+             py::arg("table"),
+             R"pbdoc(
+               Prefill the coset table.
+
+               This function can be used to start a congruence enumeration
+               from the coset table of a previous enumeration, as returned by
+               :py:meth:`table`, rather than from scratch. For example, the
+               coset table of the quotient by some extra generating pairs of
+               the semigroup defined by ``tc`` can be computed by:
+
+               .. code-block:: python
+
+                  warm = ToddCoxeter(congruence_kind.twosided)
+                  warm.set_number_of_generators(tc.number_of_generators())
+                  warm.prefill(tc.table())
+                  warm.add_pair(u, v)  # the extra pairs
+                  warm.run()
+
+               :param table: the coset table.
+               :type table: numpy.ndarray
+
+               :return: None
+
+               :Raises:
+                 ``RuntimeError`` if ``table`` is not a 2-dimensional array,
+                 if it does not have :py:meth:`number_of_generators` columns,
+                 if any of its entries is out of range, or if this has
+                 already started.
+             )pbdoc")
+        .def(py::pickle(
+            [](congruence::ToddCoxeter& tc) {
+              if (!tc.finished()) {
+                LIBSEMIGROUPS_EXCEPTION(
+                    "cannot pickle a ToddCoxeter instance that has not "
+                    "finished");
+              }
+              return py::make_tuple(static_cast<int>(tc.kind()),
+                                    tc.number_of_generators(),
+                                    todd_coxeter_table(tc));
+            },
+            [](py::tuple state) {
+              auto tc = std::make_unique<congruence::ToddCoxeter>(
+                  static_cast<congruence_kind>(state[0].cast<int>()));
+              tc->set_number_of_generators(state[1].cast<size_t>());
+              todd_coxeter_prefill(
+                  *tc,
+                  state[2].cast<libsemigroups_pybind11::input_array<size_t>>());
+              return tc;
+            }))
         .def("to_gap_string",
              &congruence::ToddCoxeter::to_gap_string,
              R"pbdoc(
@@ -570,5 +765,7 @@ namespace libsemigroups {
 
               :returns: A string
              )pbdoc");
+
+    libsemigroups_pybind11::bind_cong_intf_batch(tc, &prepare_for_batch, true);
   }
 }  // namespace libsemigroups
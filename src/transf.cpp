@@ -20,23 +20,30 @@
 #include <stddef.h>  // for size_t
 
 // C++ stl headers....
-#include <cstdint>           // for uint16_t, uint32_t, uint8_t
+#include <algorithm>         // for copy
+#include <array>             // for array
+#include <cstdint>           // for uint16_t, uint32_t, uint8_t, uint64_t
 #include <initializer_list>  // for initializer_list
 #include <iosfwd>            // for string
+#include <limits>            // for numeric_limits
 #include <string>            // for basic_string
 #include <vector>            // for vector
 
 // libsemigroups....
-#include <libsemigroups/string.hpp>  // for to_string, string_format
-#include <libsemigroups/transf.hpp>  // for PPerm, Transf, Perm, LeastPPerm
+#include <libsemigroups/exception.hpp>  // for LIBSEMIGROUPS_EXCEPTION
+#include <libsemigroups/string.hpp>     // for to_string, string_format
+#include <libsemigroups/transf.hpp>     // for PPerm, Transf, Perm, LeastPPerm
 
 // pybind11....
+#include <pybind11/numpy.h>      // for array_t
 #include <pybind11/operators.h>  // for self, self_t, operator!=, operator*
 #include <pybind11/pybind11.h>   // for module, class_, make_iterator
 #include <pybind11/stl.h>
 
 // libsemigroups_pybind11....
-#include "main.hpp"  // for init_transf
+#include "elements.hpp"  // for LIBSEMIGROUPS_PYBIND11_ENABLE_TRANSF16, ...
+#include "main.hpp"      // for init_transf
+#include "numpy.hpp"     // for input_array, batch_products
 
 namespace py = pybind11;
 
@@ -59,6 +66,70 @@ namespace libsemigroups {
       return out;
     }
 
+    // Returns a container_type (a std::vector or a std::array) holding the n
+    // images starting at first.
+    template <typename C>
+    struct images_container {
+      static C make(uint64_t const* first, size_t n) {
+        return C(first, first + n);
+      }
+    };
+
+    template <typename S, size_t N>
+    struct images_container<std::array<S, N>> {
+      static std::array<S, N> make(uint64_t const* first, size_t n) {
+        if (n != N) {
+          LIBSEMIGROUPS_EXCEPTION("expected %llu images, found %llu",
+                                  static_cast<unsigned long long>(N),
+                                  static_cast<unsigned long long>(n));
+        }
+        std::array<S, N> result;
+        std::copy(first, first + n, result.begin());
+        return result;
+      }
+    };
+
+    // Returns the element of type T with the n images starting at first, or
+    // throws if the images do not define such an element.
+    template <typename T>
+    T make_from_images(uint64_t const* first, size_t n) {
+      using container_type = typename T::container_type;
+      using value_type     = typename T::value_type;
+      for (auto it = first; it != first + n; ++it) {
+        if (*it > std::numeric_limits<value_type>::max()) {
+          LIBSEMIGROUPS_EXCEPTION("image %llu out of range, expected a "
+                                  "value in [0, %llu]",
+                                  static_cast<unsigned long long>(*it),
+                                  static_cast<unsigned long long>(
+                                      std::numeric_limits<value_type>::max()));
+        }
+      }
+      return T::template make<container_type>(
+          images_container<container_type>::make(first, n));
+    }
+
+    // Returns the array of products of the elements whose images are the rows
+    // of a and b (or a or b itself if it is 1-dimensional), see batch_shape.
+    // The images in the returned array have dtype T::value_type, and so an
+    // undefined image of a partial perm is the maximum value of that type.
+    template <typename T>
+    py::array_t<typename T::value_type>
+    ptransf_products(libsemigroups_pybind11::input_array<uint64_t> const& a,
+                     libsemigroups_pybind11::input_array<uint64_t> const& b) {
+      size_t const deg = a.ndim() == 0 ? 0 : a.shape(a.ndim() - 1);
+      return libsemigroups_pybind11::batch_products<typename T::value_type>(
+          a,
+          b,
+          1,
+          [deg](uint64_t const* first) {
+            return make_from_images<T>(first, deg);
+          },
+          [](T& z, T const& x, T const& y) { z.product_inplace(x, y); },
+          [](T const& z, typename T::value_type* first) {
+            std::copy(z.cbegin(), z.cend(), first);
+          });
+    }
+
     // This is the main function that installs common methods for derived
     // classes of PTransf
     template <typename T, typename S>
@@ -82,10 +153,72 @@ namespace libsemigroups {
                  return py::make_iterator(x.cbegin(), x.cend());
                })
           .def_static("make", &T::template make<container_type>)
+          .def(py::pickle(
+              [](T const& x) {
+                py::list images;
+                for (auto it = x.cbegin(); it != x.cend(); ++it) {
+                  images.append(*it);
+                }
+                return py::make_tuple(images);
+              },
+              [](py::tuple state) {
+                return T::template make<container_type>(
+                    state[0].cast<typename T::container_type>());
+              }))
           .def("identity", py::overload_cast<>(&T::identity, py::const_))
           .def_static("make_identity", py::overload_cast<size_t>(&T::identity))
           .def("rank", &T::rank)
-          .def("product_inplace", &T::product_inplace);
+          .def("product_inplace", &T::product_inplace)
+          .def_static("products",
+                      &ptransf_products<T>,
+                      py::arg("a"),
+                      py::arg("b"),
+                      R"pbdoc(
+                        Returns the products of many pairs of elements.
+
+                        The arguments are arrays of images with the same
+                        shape, whose last dimension is the degree, where each
+                        row is the list of images of an element; or one of
+                        them is the list of images of a single element, which
+                        is multiplied by every element in the other. The
+                        images are converted to ``numpy.uint64``, and must be
+                        at most the maximum value of the type of the images of
+                        an element, which is ``2 ** 8 - 1``, ``2 ** 16 - 1``,
+                        or ``2 ** 32 - 1`` if the name of the type ends in
+                        ``16`` or ``1``, ``2``, or ``4``, respectively. The
+                        undefined images of a partial perm are encoded as this
+                        maximum value, both in the arguments and in the
+                        returned array. The product is computed for each pair
+                        of corresponding elements, with the GIL released.
+
+                        :param a: the images of the left hand sides.
+                        :type a: numpy.ndarray
+                        :param b: the images of the right hand sides.
+                        :type b: numpy.ndarray
+
+                        :return:
+                          A ``numpy.ndarray`` of the images of the products,
+                          with the shape of the larger argument, and dtype
+                          ``numpy.uint8``, ``numpy.uint16``, or
+                          ``numpy.uint32``, the type of the images of an
+                          element.
+
+                        :raises RuntimeError:
+                          if the shapes of ``a`` and ``b`` are not
+                          compatible, or if any row of ``a`` or ``b`` is not
+                          the list of images of an element.
+
+                        .. doctest::
+
+                           >>> from libsemigroups_pybind11 import Transf1
+                           >>> x = Transf1.make([1, 0, 2])
+                           >>> y = Transf1.make([1, 1, 0])
+                           >>> z = Transf1.products([[1, 0, 2], [1, 1, 0]],
+                           ...                      [1, 1, 0])
+                           >>> z.tolist() == [list((x * y).images()),
+                           ...                list((y * y).images())]
+                           True
+                      )pbdoc");
     }
 
     template <typename T>
@@ -122,21 +255,45 @@ namespace libsemigroups {
 
   void init_transf(py::module& m) {
     // Transformations
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_TRANSF16
     bind_transf<LeastTransf<16>>(m, "Transf16");
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_TRANSF1
     bind_transf<Transf<0, uint8_t>>(m, "Transf1");
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_TRANSF2
     bind_transf<Transf<0, uint16_t>>(m, "Transf2");
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_TRANSF4
     bind_transf<Transf<0, uint32_t>>(m, "Transf4");
+#endif
 
     // Partial perms
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_PPERM16
     bind_pperm<LeastPPerm<16>>(m, "PPerm16");
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_PPERM1
     bind_pperm<PPerm<0, uint8_t>>(m, "PPerm1");
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_PPERM2
     bind_pperm<PPerm<0, uint16_t>>(m, "PPerm2");
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_PPERM4
     bind_pperm<PPerm<0, uint32_t>>(m, "PPerm4");
+#endif
 
     // Perms
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_PERM16
     bind_perm<LeastPerm<16>, LeastTransf<16>>(m, "Perm16");
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_PERM1
     bind_perm<Perm<0, uint8_t>, Transf<0, uint8_t>>(m, "Perm1");
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_PERM2
     bind_perm<Perm<0, uint16_t>, Transf<0, uint16_t>>(m, "Perm2");
+#endif
+#ifdef LIBSEMIGROUPS_PYBIND11_ENABLE_PERM4
     bind_perm<Perm<0, uint32_t>, Transf<0, uint32_t>>(m, "Perm4");
+#endif
   }
 }  // namespace libsemigroups
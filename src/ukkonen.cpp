@@ -17,22 +17,382 @@
 //
 
 // C std headers....
+#include <stddef.h>  // for size_t
+
 // C++ stl headers....
+#include <string>  // for string
+#include <vector>  // for vector
 
 // libsemigroups....
 #include <libsemigroups/types.hpp>    // for rule_type
 #include <libsemigroups/ukkonen.hpp>  // for Ukkonen
 
 // pybind11....
+#include <pybind11/numpy.h>     // for array_t
 #include <pybind11/pybind11.h>  // for class_, init, module
 #include <pybind11/stl.h>
 
 // libsemigroups_pybind11....
-#include "main.hpp"  // for init_ukkonen
+#include "main.hpp"   // for init_ukkonen
+#include "numpy.hpp"  // for unflatten_words, vectorize
 
 namespace py = pybind11;
 
 namespace libsemigroups {
+  namespace {
+    using libsemigroups_pybind11::unflatten_words;
+    using libsemigroups_pybind11::vectorize;
+
+    // Adds the function name to m, which returns the NumPy array whose i-th
+    // entry is f(u, w), where w is the i-th word in words, which can be given
+    // as a list of lists of int, as a list of str, or in the flat format
+    // described in unflatten_words. The GIL is released while f is being
+    // applied, and so f must not call into Python. The docstring doc is that
+    // of the first two overloads, the flat format one has its own.
+    template <typename S, typename F>
+    void def_many(py::module& m, char const* name, F f, char const* doc) {
+      m.def(
+           name,
+           [f](Ukkonen const& u, std::vector<word_type> const& words) {
+             return vectorize<S>(
+                 words, [&u, &f](word_type const& w) { return f(u, w); });
+           },
+           py::arg("u"),
+           py::arg("words"),
+           doc)
+          .def(
+              name,
+              [f](Ukkonen const& u, std::vector<std::string> const& words) {
+                return vectorize<S>(
+                    words, [&u, &f](std::string const& w) { return f(u, w); });
+              },
+              py::arg("u"),
+              py::arg("words"))
+          .def(
+              name,
+              [f](Ukkonen const&    u,
+                  py::object const& offsets,
+                  py::object const& letters) {
+                return vectorize<S>(
+                    unflatten_words(offsets, letters),
+                    [&u, &f](word_type const& w) { return f(u, w); });
+              },
+              py::arg("u"),
+              py::arg("offsets"),
+              py::arg("letters"),
+              R"pbdoc(
+                As above, but the words are given in a flat format, where the
+                ``i``-th word is ``letters[offsets[i]:offsets[i + 1]]``.
+
+                :param u: the :py:class:`Ukkonen` object
+                :type u: Ukkonen
+                :param offsets: the offsets of the words in ``letters``
+                :type offsets: numpy.ndarray
+                :param letters: the letters of the words
+                :type letters: numpy.ndarray
+              )pbdoc");
+    }
+
+    void init_ukkonen_many(py::module& m) {
+      def_many<bool>(
+          m,
+          "is_subword_many_no_checks",
+          [](Ukkonen const& u, auto const& w) {
+            return ukkonen::is_subword_no_checks(u, w);
+          },
+          R"pbdoc(
+            Check if many words are subwords of any word in a suffix tree.
+
+            The ``i``-th entry of the returned array is ``True`` if the ``i``-th
+            word in ``words`` is a subword of one of the words in ``u``, see
+            :py:func:`is_subword_no_checks`. The GIL is released while the words
+            are checked.
+
+            :param u: the :py:class:`Ukkonen` object
+            :type u: Ukkonen
+            :param words: the possible subwords
+            :type words: Union[List[List[int]], List[str]]
+
+            :Returns: A ``numpy.ndarray`` of ``bool``.
+
+            .. warning::
+              This function does no checks on its arguments whatsoever.
+          )pbdoc");
+      def_many<bool>(
+          m,
+          "is_subword_many",
+          [](Ukkonen const& u, auto const& w) {
+            return ukkonen::is_subword(u, w);
+          },
+          R"pbdoc(
+            Check if many words are subwords of any word in a suffix tree.
+
+            The ``i``-th entry of the returned array is ``True`` if the ``i``-th
+            word in ``words`` is a subword of one of the words in ``u``, see
+            :py:func:`is_subword`.
+
+            :param u: the :py:class:`Ukkonen` object
+            :type u: Ukkonen
+            :param words: the possible subwords
+            :type words: Union[List[List[int]], List[str]]
+
+            :Returns: A ``numpy.ndarray`` of ``bool``.
+
+            :Raises:
+              ``RunTimeError`` if :py:meth:`Ukkonen.validate_word` raises for
+              any word in ``words``.
+          )pbdoc");
+      def_many<bool>(
+          m,
+          "is_suffix_many_no_checks",
+          [](Ukkonen const& u, auto const& w) {
+            return ukkonen::is_suffix_no_checks(u, w);
+          },
+          R"pbdoc(
+            Check if many words are suffixes of any word in a suffix tree.
+
+            The ``i``-th entry of the returned array is ``True`` if the ``i``-th
+            word in ``words`` is a suffix of one of the words in ``u``, see
+            :py:func:`is_suffix_no_checks`.
+
+            :param u: the :py:class:`Ukkonen` object
+            :type u: Ukkonen
+            :param words: the possible suffixes
+            :type words: Union[List[List[int]], List[str]]
+
+            :Returns: A ``numpy.ndarray`` of ``bool``.
+
+            .. warning::
+              This function does no checks on its arguments whatsoever.
+          )pbdoc");
+      def_many<bool>(
+          m,
+          "is_suffix_many",
+          [](Ukkonen const& u, auto const& w) {
+            return ukkonen::is_suffix(u, w);
+          },
+          R"pbdoc(
+            Check if many words are suffixes of any word in a suffix tree.
+
+            The ``i``-th entry of the returned array is ``True`` if the ``i``-th
+            word in ``words`` is a suffix of one of the words in ``u``, see
+            :py:func:`is_suffix`.
+
+            :param u: the :py:class:`Ukkonen` object
+            :type u: Ukkonen
+            :param words: the possible suffixes
+            :type words: Union[List[List[int]], List[str]]
+
+            :Returns: A ``numpy.ndarray`` of ``bool``.
+
+            :Raises:
+              ``RunTimeError`` if :py:meth:`Ukkonen.validate_word` raises for
+              any word in ``words``.
+          )pbdoc");
+      def_many<bool>(
+          m,
+          "is_piece_many_no_checks",
+          [](Ukkonen const& u, auto const& w) {
+            return ukkonen::is_piece_no_checks(u, w);
+          },
+          R"pbdoc(
+            Check if many words are pieces.
+
+            The ``i``-th entry of the returned array is ``True`` if the ``i``-th
+            word in ``words`` is a piece, i.e. a subword of two distinct words
+            in ``u``, or of one word in two distinct places, see
+            :py:func:`is_piece_no_checks`.
+
+            :param u: the :py:class:`Ukkonen` object
+            :type u: Ukkonen
+            :param words: the possible pieces
+            :type words: Union[List[List[int]], List[str]]
+
+            :Returns: A ``numpy.ndarray`` of ``bool``.
+
+            .. warning::
+              This function does no checks on its arguments whatsoever.
+          )pbdoc");
+      def_many<bool>(
+          m,
+          "is_piece_many",
+          [](Ukkonen const& u, auto const& w) {
+            return ukkonen::is_piece(u, w);
+          },
+          R"pbdoc(
+            Check if many words are pieces.
+
+            The ``i``-th entry of the returned array is ``True`` if the ``i``-th
+            word in ``words`` is a piece, see :py:func:`is_piece`.
+
+            :param u: the :py:class:`Ukkonen` object
+            :type u: Ukkonen
+            :param words: the possible pieces
+            :type words: Union[List[List[int]], List[str]]
+
+            :Returns: A ``numpy.ndarray`` of ``bool``.
+
+            :Raises:
+              ``RunTimeError`` if :py:meth:`Ukkonen.validate_word` raises for
+              any word in ``words``.
+          )pbdoc");
+      def_many<size_t>(
+          m,
+          "maximal_piece_prefix_lengths_no_checks",
+          [](Ukkonen const& u, auto const& w) {
+            return static_cast<size_t>(
+                ukkonen::maximal_piece_prefix_no_checks(u, w) - w.cbegin());
+          },
+          R"pbdoc(
+            Find the lengths of the maximal piece prefixes of many words.
+
+            The ``i``-th entry of the returned array is the length of the
+            longest prefix of the ``i``-th word in ``words`` that is a piece,
+            see :py:func:`maximal_piece_prefix_no_checks`.
+
+            :param u: the :py:class:`Ukkonen` object
+            :type u: Ukkonen
+            :param words: the words
+            :type words: Union[List[List[int]], List[str]]
+
+            :Returns: A ``numpy.ndarray`` of ``int``.
+
+            .. warning::
+              This function does no checks on its arguments whatsoever.
+          )pbdoc");
+      def_many<size_t>(
+          m,
+          "maximal_piece_prefix_lengths",
+          [](Ukkonen const& u, auto const& w) {
+            return static_cast<size_t>(ukkonen::maximal_piece_prefix(u, w)
+                                       - w.cbegin());
+          },
+          R"pbdoc(
+            Find the lengths of the maximal piece prefixes of many words.
+
+            The ``i``-th entry of the returned array is the length of the
+            longest prefix of the ``i``-th word in ``words`` that is a piece,
+            see :py:func:`maximal_piece_prefix`.
+
+            :param u: the :py:class:`Ukkonen` object
+            :type u: Ukkonen
+            :param words: the words
+            :type words: Union[List[List[int]], List[str]]
+
+            :Returns: A ``numpy.ndarray`` of ``int``.
+
+            :Raises:
+              ``RunTimeError`` if :py:meth:`Ukkonen.validate_word` raises for
+              any word in ``words``.
+          )pbdoc");
+      def_many<size_t>(
+          m,
+          "maximal_piece_suffix_lengths_no_checks",
+          [](Ukkonen const& u, auto const& w) {
+            return static_cast<size_t>(
+                w.cend() - ukkonen::maximal_piece_suffix_no_checks(u, w));
+          },
+          R"pbdoc(
+            Find the lengths of the maximal piece suffixes of many words.
+
+            The ``i``-th entry of the returned array is the length of the
+            longest suffix of the ``i``-th word in ``words`` that is a piece,
+            see :py:func:`maximal_piece_suffix_no_checks`.
+
+            :param u: the :py:class:`Ukkonen` object
+            :type u: Ukkonen
+            :param words: the words
+            :type words: Union[List[List[int]], List[str]]
+
+            :Returns: A ``numpy.ndarray`` of ``int``.
+
+            .. warning::
+              This function does no checks on its arguments whatsoever.
+          )pbdoc");
+      def_many<size_t>(
+          m,
+          "maximal_piece_suffix_lengths",
+          [](Ukkonen const& u, auto const& w) {
+            return static_cast<size_t>(w.cend()
+                                       - ukkonen::maximal_piece_suffix(u, w));
+          },
+          R"pbdoc(
+            Find the lengths of the maximal piece suffixes of many words.
+
+            The ``i``-th entry of the returned array is the length of the
+            longest suffix of the ``i``-th word in ``words`` that is a piece,
+            see :py:func:`maximal_piece_suffix`.
+
+            :param u: the :py:class:`Ukkonen` object
+            :type u: Ukkonen
+            :param words: the words
+            :type words: Union[List[List[int]], List[str]]
+
+            :Returns: A ``numpy.ndarray`` of ``int``.
+
+            :Raises:
+              ``RunTimeError`` if :py:meth:`Ukkonen.validate_word` raises for
+              any word in ``words``.
+          )pbdoc");
+      def_many<size_t>(
+          m,
+          "number_of_pieces_many_no_checks",
+          [](Ukkonen const& u, auto const& w) {
+            return static_cast<size_t>(
+                ukkonen::number_of_pieces_no_checks(u, w));
+          },
+          R"pbdoc(
+            Find the number of pieces in decompositions of many words.
+
+            The ``i``-th entry of the returned array is the least number of
+            pieces whose product is the ``i``-th word in ``words``, see
+            :py:func:`number_of_pieces_no_checks`. The entries corresponding to
+            words with no decomposition into pieces are the maximum value of
+            the dtype of the returned array, i.e.
+            ``numpy.iinfo(result.dtype).max``, which compares equal to
+            ``POSITIVE_INFINITY`` when converted to Python using ``tolist``.
+
+            :param u: the :py:class:`Ukkonen` object
+            :type u: Ukkonen
+            :param words: the words
+            :type words: Union[List[List[int]], List[str]]
+
+            :Returns: A ``numpy.ndarray`` of ``int``.
+
+            .. warning::
+              This function does no checks on its arguments whatsoever.
+          )pbdoc");
+      def_many<size_t>(
+          m,
+          "number_of_pieces_many",
+          [](Ukkonen const& u, auto const& w) {
+            return static_cast<size_t>(ukkonen::number_of_pieces(u, w));
+          },
+          R"pbdoc(
+            Find the number of pieces in decompositions of many words.
+
+            The ``i``-th entry of the returned array is the least number of
+            pieces whose product is the ``i``-th word in ``words``, or the
+            maximum value of the dtype of the returned array, i.e.
+            ``numpy.iinfo(result.dtype).max``, if there is no such
+            decomposition, see :py:func:`number_of_pieces`. The latter entries
+            compare equal to ``POSITIVE_INFINITY`` when converted to Python
+            using ``tolist``.
+
+            :param u: the :py:class:`Ukkonen` object
+            :type u: Ukkonen
+            :param words: the words
+            :type words: Union[List[List[int]], List[str]]
+
+            :Returns: A ``numpy.ndarray`` of ``int``.
+
+            :Raises:
+              ``RunTimeError`` if :py:meth:`Ukkonen.validate_word` raises for
+              any word in ``words``.
+          )pbdoc");
+    }
+  }  // namespace
+
   void init_ukkonen(py::module& m) {
     py::class_<Ukkonen>(m, "Ukkonen")
         .def(py::init<>())
@@ -1091,5 +1451,6 @@ namespace libsemigroups {
               :Raises:
                 ``RunTimeError`` if :py:meth:`Ukkonen.validate_word` raises.
              )pbdoc");
+    init_ukkonen_many(m);
   }
 }  // namespace libsemigroups
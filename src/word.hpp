@@ -0,0 +1,255 @@
+//
+// libsemigroups_pybind11
+// Copyright (C) 2023 James D. Mitchell
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+// This file contains the class Word, which is the compact representation of
+// a word_type exposed to Python, and the pybind11 type_caster used for
+// word_type throughout the extension. The type_caster converts any object
+// supporting the buffer protocol with an integer format (such as a Word or a
+// NumPy array) without creating a Python int per letter, and falls back to
+// the usual conversion from a sequence of int otherwise.
+//
+// This file is included by main.hpp so that every translation unit in the
+// extension uses the same type_caster for word_type.
+
+#ifndef SRC_WORD_HPP_
+#define SRC_WORD_HPP_
+
+// C std headers....
+#include <stddef.h>  // for size_t
+#include <stdint.h>  // for int8_t, uint8_t, int16_t, uint16_t, ...
+#include <string.h>  // for memcpy
+
+// C++ stl headers....
+#include <string>       // for string
+#include <type_traits>  // for is_signed, true_type, false_type
+#include <utility>      // for move
+#include <vector>       // for vector
+
+// libsemigroups....
+#include <libsemigroups/types.hpp>  // for word_type, letter_type
+
+// pybind11....
+#include <pybind11/pybind11.h>  // for buffer, buffer_info, handle
+#include <pybind11/stl.h>       // for list_caster
+
+namespace libsemigroups {
+  namespace py = pybind11;
+
+  namespace libsemigroups_pybind11 {
+
+    // A word whose letters are stored using the smallest of uint8_t,
+    // uint16_t, uint32_t, and uint64_t that can hold every letter.
+    class Word {
+     public:
+      explicit Word(word_type const& w) : _data(), _itemsize(1) {
+        for (auto const& x : w) {
+          while (_itemsize < sizeof(letter_type)
+                 && (x >> (8 * _itemsize)) != 0) {
+            _itemsize *= 2;
+          }
+        }
+        _data.resize(w.size() * _itemsize);
+        switch (_itemsize) {
+          case 1:
+            fill<uint8_t>(w);
+            break;
+          case 2:
+            fill<uint16_t>(w);
+            break;
+          case 4:
+            fill<uint32_t>(w);
+            break;
+          default:
+            fill<uint64_t>(w);
+        }
+      }
+
+      size_t size() const noexcept {
+        return _data.size() / _itemsize;
+      }
+
+      size_t itemsize() const noexcept {
+        return _itemsize;
+      }
+
+      letter_type at(size_t i) const {
+        switch (_itemsize) {
+          case 1:
+            return get<uint8_t>(i);
+          case 2:
+            return get<uint16_t>(i);
+          case 4:
+            return get<uint32_t>(i);
+          default:
+            return get<uint64_t>(i);
+        }
+      }
+
+      word_type letters() const {
+        word_type result(size());
+        for (size_t i = 0; i < result.size(); ++i) {
+          result[i] = at(i);
+        }
+        return result;
+      }
+
+      // Returns a read-only buffer_info viewing the letters of this.
+      py::buffer_info buffer_info() const {
+        return py::buffer_info(const_cast<unsigned char*>(_data.data()),
+                               static_cast<py::ssize_t>(_itemsize),
+                               format(),
+                               static_cast<py::ssize_t>(size()),
+                               true);
+      }
+
+      bool operator==(Word const& that) const {
+        return _itemsize == that._itemsize && _data == that._data;
+      }
+
+     private:
+      std::string format() const {
+        switch (_itemsize) {
+          case 1:
+            return py::format_descriptor<uint8_t>::format();
+          case 2:
+            return py::format_descriptor<uint16_t>::format();
+          case 4:
+            return py::format_descriptor<uint32_t>::format();
+          default:
+            return py::format_descriptor<uint64_t>::format();
+        }
+      }
+
+      template <typename T>
+      void fill(word_type const& w) {
+        for (size_t i = 0; i < w.size(); ++i) {
+          T const x = static_cast<T>(w[i]);
+          memcpy(_data.data() + i * sizeof(T), &x, sizeof(T));
+        }
+      }
+
+      template <typename T>
+      letter_type get(size_t i) const {
+        T x;
+        memcpy(&x, _data.data() + i * sizeof(T), sizeof(T));
+        return static_cast<letter_type>(x);
+      }
+
+      std::vector<unsigned char> _data;
+      size_t                     _itemsize;
+    };
+
+    template <typename T>
+    bool is_negative(T x, std::true_type) {
+      return x < 0;
+    }
+
+    template <typename T>
+    bool is_negative(T, std::false_type) {
+      return false;
+    }
+
+    template <typename T>
+    bool copy_letters(py::buffer_info const& info, word_type& out) {
+      char const*       ptr    = static_cast<char const*>(info.ptr);
+      py::ssize_t const stride = info.strides[0];
+      out.resize(static_cast<size_t>(info.shape[0]));
+      for (size_t i = 0; i < out.size(); ++i) {
+        T x;
+        memcpy(&x, ptr + static_cast<py::ssize_t>(i) * stride, sizeof(T));
+        if (is_negative(x, std::is_signed<T>())) {
+          return false;
+        }
+        out[i] = static_cast<letter_type>(x);
+      }
+      return true;
+    }
+
+    template <typename S, typename U>
+    bool copy_letters_as(py::buffer_info const& info,
+                         bool                   is_signed,
+                         word_type&             out) {
+      return is_signed ? copy_letters<S>(info, out)
+                       : copy_letters<U>(info, out);
+    }
+
+    // Copies the letters of src into out, if src supports the buffer protocol
+    // and is 1-dimensional with a native integer format, and returns true.
+    // Otherwise, out is not modified and false is returned. Instances of
+    // bytes and bytearray are never converted.
+    inline bool load_word(py::handle src, word_type& out) {
+      if (!PyObject_CheckBuffer(src.ptr()) || PyBytes_Check(src.ptr())
+          || PyByteArray_Check(src.ptr())) {
+        return false;
+      }
+      py::buffer_info info;
+      try {
+        info = py::reinterpret_borrow<py::buffer>(src).request();
+      } catch (py::error_already_set&) {
+        return false;
+      }
+      std::string fmt = info.format;
+      if (!fmt.empty() && (fmt[0] == '@' || fmt[0] == '=')) {
+        fmt.erase(0, 1);
+      }
+      if (info.ndim != 1 || fmt.size() != 1
+          || std::string("bBhHiIlLqQ").find(fmt[0]) == std::string::npos) {
+        return false;
+      }
+      bool const is_signed = (fmt[0] >= 'a' && fmt[0] <= 'z');
+      word_type  result;
+      bool       success = false;
+      switch (info.itemsize) {
+        case 1:
+          success = copy_letters_as<int8_t, uint8_t>(info, is_signed, result);
+          break;
+        case 2:
+          success = copy_letters_as<int16_t, uint16_t>(info, is_signed, result);
+          break;
+        case 4:
+          success = copy_letters_as<int32_t, uint32_t>(info, is_signed, result);
+          break;
+        case 8:
+          success = copy_letters_as<int64_t, uint64_t>(info, is_signed, result);
+          break;
+        default:
+          break;
+      }
+      if (success) {
+        out = std::move(result);
+      }
+      return success;
+    }
+  }  // namespace libsemigroups_pybind11
+}  // namespace libsemigroups
+
+namespace pybind11 {
+  namespace detail {
+    template <>
+    struct type_caster<libsemigroups::word_type>
+        : list_caster<libsemigroups::word_type, libsemigroups::letter_type> {
+      bool load(handle src, bool convert) {
+        return libsemigroups::libsemigroups_pybind11::load_word(src, value)
+               || list_caster<libsemigroups::word_type,
+                              libsemigroups::letter_type>::load(src, convert);
+      }
+    };
+  }  // namespace detail
+}  // namespace pybind11
+
+#endif  // SRC_WORD_HPP_
@@ -18,30 +18,241 @@
 
 // C std headers....
 #include <stddef.h>  // for size_t
+#include <stdint.h>  // for uint64_t
 
 // C++ stl headers....
+#include <algorithm>         // for lexicographical_compare
+#include <functional>        // for hash
 #include <initializer_list>  // for initializer_list
 #include <iosfwd>            // for string
+#include <string>            // for string
+#include <utility>           // for move, pair
 #include <vector>            // for vector
 
 // libsemigroups....
-#include <libsemigroups/siso.hpp>   // for const_silo_iterator, const_sislo...
-#include <libsemigroups/types.hpp>  // for word_type
-#include <libsemigroups/wilo.hpp>   // for const_wilo_iterator, cbegin_wilo
-#include <libsemigroups/wislo.hpp>  // for const_wislo_iterator, cbegin_wislo
-#include <libsemigroups/word.hpp>   // for number_of_words
+#include <libsemigroups/exception.hpp>  // for LIBSEMIGROUPS_EXCEPTION
+#include <libsemigroups/siso.hpp>       // for const_silo_iterator, ...
+#include <libsemigroups/types.hpp>      // for word_type
+#include <libsemigroups/wilo.hpp>       // for const_wilo_iterator, cbegin_wilo
+#include <libsemigroups/wislo.hpp>      // for const_wislo_iterator, ...
+#include <libsemigroups/word.hpp>       // for number_of_words
 
 // pybind11....
 #include <pybind11/pybind11.h>  // for make_iterator, module
 #include <pybind11/stl.h>
 
 // libsemigroups_pybind11....
-#include "main.hpp"  // for init_words
+#include "main.hpp"         // for init_words
+#include "path-chunks.hpp"  // for bind_path_chunks, make_path_chunks
+#include "word.hpp"         // for Word
 
 namespace py = pybind11;
 
 namespace libsemigroups {
+  namespace {
+    using word_range = std::pair<word_type, word_type>;
+
+    bool lex_less(word_type const& u, word_type const& v) {
+      return std::lexicographical_compare(
+          u.cbegin(), u.cend(), v.cbegin(), v.cend());
+    }
+
+    bool shortlex_less(word_type const& u, word_type const& v) {
+      return u.size() < v.size() || (u.size() == v.size() && lex_less(u, v));
+    }
+
+    // Replaces p by the next word of the same length over n letters in
+    // lexicographic order, and returns false if there is no such word (in
+    // which case every letter of p is 0).
+    bool next_word(word_type& p, size_t n) {
+      for (size_t i = p.size(); i-- > 0;) {
+        if (++p[i] < n) {
+          return true;
+        }
+        p[i] = 0;
+      }
+      return false;
+    }
+
+    // Appends the intersection of [lo, hi) and [first, last), with respect
+    // to the order less, to result, if it is not empty.
+    template <typename Less>
+    void add_range(std::vector<word_range>& result,
+                   word_type const&         lo,
+                   word_type const&         hi,
+                   word_type const&         first,
+                   word_type const&         last,
+                   Less&&                   less) {
+      word_type const& x = less(lo, first) ? first : lo;
+      word_type const& y = less(last, hi) ? last : hi;
+      if (less(x, y)) {
+        result.emplace_back(x, y);
+      }
+    }
+
+    // Returns ranges [u, v) such that wilo(n, upper_bound, u, v) for all of
+    // the ranges enumerate disjoint sets of words, whose union (in order) is
+    // wilo(n, upper_bound, first, last). The words in each range have the
+    // same prefix of length prefix_length, except that every word shorter
+    // than prefix_length belongs to the range of its extension by 0s.
+    std::vector<word_range> wilo_split(size_t           n,
+                                       size_t           upper_bound,
+                                       word_type const& first,
+                                       word_type const& last,
+                                       size_t           prefix_length) {
+      if (prefix_length >= upper_bound && upper_bound != 0) {
+        LIBSEMIGROUPS_EXCEPTION("the prefix length must be less than the "
+                                "upper bound %llu, found %llu",
+                                uint64_t(upper_bound),
+                                uint64_t(prefix_length));
+      }
+      std::vector<word_range> result;
+      if (n == 0 || prefix_length == 0) {
+        add_range(result, first, last, first, last, lex_less);
+        return result;
+      }
+      // The words extending p (and its prefixes with trailing 0s) start at
+      // p with its trailing 0s removed.
+      auto start = [](word_type p) {
+        while (!p.empty() && p.back() == 0) {
+          p.pop_back();
+        }
+        return p;
+      };
+      word_type p(prefix_length, 0);
+      word_type lo = start(p);
+      bool      more;
+      do {
+        more = next_word(p, n);
+        word_type hi = more ? start(p) : last;
+        add_range(result, lo, hi, first, last, lex_less);
+        lo = std::move(hi);
+      } while (more);
+      return result;
+    }
+
+    // Returns ranges [u, v) such that wislo(n, u, v) for all of the ranges
+    // enumerate disjoint sets of words, whose union (in order) is wislo(n,
+    // first, last). The words in each range have the same length and the
+    // same prefix of length prefix_length (or are equal to this prefix).
+    std::vector<word_range> wislo_split(size_t           n,
+                                        word_type const& first,
+                                        word_type const& last,
+                                        size_t           prefix_length) {
+      std::vector<word_range> result;
+      if (n == 0) {
+        add_range(result, first, last, first, last, shortlex_less);
+        return result;
+      }
+      for (size_t len = first.size(); len <= last.size(); ++len) {
+        size_t const k = std::min(prefix_length, len);
+        word_type    p(k, 0);
+        bool         more;
+        do {
+          word_type lo(p);
+          lo.resize(len, 0);
+          more = next_word(p, n);
+          word_type hi(p);
+          hi.resize(more ? len : len + 1, 0);
+          add_range(result, lo, hi, first, last, shortlex_less);
+        } while (more);
+      }
+      return result;
+    }
+  }  // namespace
+
   void init_words(py::module& m) {
+    ////////////////////////////////////////////////////////////////////////
+    // word.hpp
+    ////////////////////////////////////////////////////////////////////////
+
+    using libsemigroups_pybind11::Word;
+
+    py::class_<Word>(m, "Word", py::buffer_protocol(), R"pbdoc(
+      A word whose letters are stored compactly, using 1, 2, 4, or 8 bytes per
+      letter depending on the largest letter.
+
+      A :py:class:`Word` supports the buffer protocol, and so, for example,
+      ``numpy.asarray(w)`` and ``memoryview(w)`` view the letters of ``w``
+      without copying them. Every function taking a word as an argument
+      accepts a :py:class:`Word`, or any other 1-dimensional buffer of
+      integers such as a ``numpy.ndarray``, in place of a list of ``int``;
+      such arguments are converted without creating a Python ``int`` for
+      each letter.
+    )pbdoc")
+        .def(py::init<word_type const&>(),
+             py::arg("letters"),
+             R"pbdoc(
+               Construct from a list of ``int``, or any other word.
+
+               :Parameters: **letters** (List[int]) the letters of the word.
+             )pbdoc")
+        .def_buffer([](Word const& w) { return w.buffer_info(); })
+        .def("__len__", &Word::size)
+        .def("__getitem__",
+             [](Word const& w, py::ssize_t i) {
+               py::ssize_t const n = static_cast<py::ssize_t>(w.size());
+               if (i < 0) {
+                 i += n;
+               }
+               if (i < 0 || i >= n) {
+                 throw py::index_error("Word index out of range");
+               }
+               return w.at(static_cast<size_t>(i));
+             })
+        .def("__iter__",
+             [](Word const& w) { return py::iter(py::cast(w.letters())); })
+        .def(
+            "__eq__",
+            [](Word const& x, word_type const& y) { return x.letters() == y; },
+            py::is_operator())
+        .def(
+            "__ne__",
+            [](Word const& x, word_type const& y) { return x.letters() != y; },
+            py::is_operator())
+        .def("__hash__",
+             [](Word const& w) {
+               size_t seed = 0;
+               for (size_t i = 0; i < w.size(); ++i) {
+                 seed ^= std::hash<size_t>()(w.at(i)) + 0x9e3779b97f4a7c16
+                         + (seed << 6) + (seed >> 2);
+               }
+               return seed;
+             })
+        .def("__repr__",
+             [](Word const& w) {
+               return "Word("
+                      + std::string(py::repr(py::cast(w.letters()))) + ")";
+             })
+        .def("itemsize",
+             &Word::itemsize,
+             R"pbdoc(
+               Returns the number of bytes used to store each letter.
+
+               :Parameters: None.
+               :return: An ``int``, one of ``1``, ``2``, ``4``, or ``8``.
+             )pbdoc")
+        .def("letters",
+             &Word::letters,
+             R"pbdoc(
+               Returns the letters of the word.
+
+               :Parameters: None.
+               :return: A ``List[int]``.
+             )pbdoc");
+
+    ////////////////////////////////////////////////////////////////////////
+    // Chunks
+    ////////////////////////////////////////////////////////////////////////
+
+    using libsemigroups_pybind11::bind_path_chunks;
+    using libsemigroups_pybind11::make_path_chunks;
+
+    bind_path_chunks<const_silo_iterator>(m, "SiloChunks");
+    bind_path_chunks<const_sislo_iterator>(m, "SisloChunks");
+    bind_path_chunks<const_wilo_iterator>(m, "WiloChunks");
+    bind_path_chunks<const_wislo_iterator>(m, "WisloChunks");
+
     ////////////////////////////////////////////////////////////////////////
     // siso.hpp
     ////////////////////////////////////////////////////////////////////////
@@ -84,6 +295,55 @@ namespace libsemigroups {
            ['b', 'bb', 'ba', 'a', 'ab', 'aa']
         )pbdoc");
 
+    m.def(
+        "silo_chunks",
+        [](std::string const& alphabet,
+           size_t             upper_bound,
+           std::string const& first,
+           std::string const& last,
+           size_t             chunk_size) {
+          return make_path_chunks(
+              cbegin_silo(alphabet, upper_bound, first, last),
+              cend_silo(alphabet, upper_bound, first, last),
+              chunk_size);
+        },
+        py::arg("alphabet"),
+        py::arg("upper_bound"),
+        py::arg("first"),
+        py::arg("last"),
+        py::arg("chunk_size") = 4096,
+        R"pbdoc(
+        Returns an iterator yielding chunks of the strings in lexicographic
+        order (silo).
+
+        Each chunk is a tuple ``(offsets, letters)``, where ``offsets`` is a
+        ``numpy.ndarray`` and ``letters`` is a ``bytes`` object, such that the
+        ``i``-th string in the chunk is
+        ``letters[offsets[i]:offsets[i + 1]].decode()``. This is equivalent
+        to, but much faster than, :py:func:`silo`.
+
+        :param alphabet: the alphabet
+        :type alphabet: str
+        :param upper_bound: the maximum length of string to return
+        :type upper_bound: int
+        :param first: the first string
+        :type first: str
+        :param last: one past the last string
+        :type last: str
+        :param chunk_size:
+          the maximum number of strings in a chunk (default: ``4096``)
+        :type chunk_size: int
+
+        :return: An iterator.
+
+        .. doctest::
+
+           >>> from libsemigroups_pybind11 import silo_chunks
+           >>> offsets, letters = next(silo_chunks("ba", 3, "b", "aaa"))
+           >>> offsets.tolist(), letters
+           ([0, 1, 3, 5, 6, 8, 10], b'bbbbaaabaa')
+        )pbdoc");
+
     m.def(
         "sislo",
         [](std::string const& alphabet,
@@ -116,6 +376,40 @@ namespace libsemigroups {
              ['b', 'a', 'bb', 'ba', 'ab', 'aa', 'bbb', 'bba', 'bab', 'baa', 'abb', 'aba', 'aab']
         )pbdoc");
 
+    m.def(
+        "sislo_chunks",
+        [](std::string const& alphabet,
+           std::string const& first,
+           std::string const& last,
+           size_t             chunk_size) {
+          return make_path_chunks(cbegin_sislo(alphabet, first, last),
+                                  cend_sislo(alphabet, first, last),
+                                  chunk_size);
+        },
+        py::arg("alphabet"),
+        py::arg("first"),
+        py::arg("last"),
+        py::arg("chunk_size") = 4096,
+        R"pbdoc(
+          Returns an iterator yielding chunks of the strings in short-lex
+          order (sislo).
+
+          See :py:func:`silo_chunks` for the format of the chunks. This is
+          equivalent to, but much faster than, :py:func:`sislo`.
+
+          :param alphabet: the alphabet
+          :type alphabet: str
+          :param first: the first string
+          :type first: str
+          :param last: one past the last string
+          :type last: str
+          :param chunk_size:
+            the maximum number of strings in a chunk (default: ``4096``)
+          :type chunk_size: int
+
+          :return: An iterator.
+        )pbdoc");
+
     ////////////////////////////////////////////////////////////////////////
     // wilo.hpp
     ////////////////////////////////////////////////////////////////////////
@@ -157,6 +451,96 @@ namespace libsemigroups {
              [[0], [0, 0], [0, 1], [1], [1, 0], [1, 1]]
         )pbdoc");
 
+    m.def(
+        "wilo_chunks",
+        [](size_t const     n,
+           size_t const     upper_bound,
+           word_type const& first,
+           word_type const& last,
+           size_t           chunk_size) {
+          return make_path_chunks(cbegin_wilo(n, upper_bound, first, last),
+                                  cend_wilo(n, upper_bound, first, last),
+                                  chunk_size);
+        },
+        py::arg("n"),
+        py::arg("upper_bound"),
+        py::arg("first"),
+        py::arg("last"),
+        py::arg("chunk_size") = 4096,
+        R"pbdoc(
+          Returns an iterator yielding chunks of the words in lexicographic
+          order (wilo).
+
+          Each chunk is a tuple ``(offsets, letters)`` of ``numpy.ndarray``
+          such that the ``i``-th word in the chunk is
+          ``letters[offsets[i]:offsets[i + 1]]``. This is equivalent to, but
+          much faster than, :py:func:`wilo`.
+
+          :param n: the number of letters
+          :type n: int
+          :param upper_bound: the maximum length of string to return
+          :type upper_bound: int
+          :param first: the first word
+          :type first: list
+          :param last: one past the last word
+          :type last: list
+          :param chunk_size:
+            the maximum number of words in a chunk (default: ``4096``)
+          :type chunk_size: int
+
+          :return: An iterator.
+
+          .. doctest::
+
+             >>> from libsemigroups_pybind11 import wilo_chunks
+             >>> offsets, letters = next(wilo_chunks(2, 3, [0], [1, 1, 1]))
+             >>> offsets.tolist(), letters.tolist()
+             ([0, 1, 3, 5, 6, 8, 10], [0, 0, 0, 0, 1, 1, 1, 0, 1, 1])
+        )pbdoc");
+
+    m.def("wilo_split",
+          &wilo_split,
+          py::arg("n"),
+          py::arg("upper_bound"),
+          py::arg("first"),
+          py::arg("last"),
+          py::arg("prefix_length"),
+          R"pbdoc(
+            Split a range of words in lexicographic order by prefix.
+
+            Returns a list of pairs ``(u, v)`` such that the ranges
+            ``wilo(n, upper_bound, u, v)`` are disjoint, and contain (in
+            order) the words in ``wilo(n, upper_bound, first, last)``. The
+            words in each range have the same prefix of length
+            ``prefix_length``, except that a word shorter than this belongs to
+            the range of its extension by ``0``'s. The ranges can be
+            enumerated independently, for example in different processes,
+            and there are at most :math:`n ^ k` of them, where :math:`k` is
+            ``prefix_length``.
+
+            :param n: the number of letters
+            :type n: int
+            :param upper_bound: the maximum length of string to return
+            :type upper_bound: int
+            :param first: the first word
+            :type first: list
+            :param last: one past the last word
+            :type last: list
+            :param prefix_length: the length of the prefixes
+            :type prefix_length: int
+
+            :return: A list of pairs of words.
+
+            :raises RuntimeError:
+              if ``prefix_length`` is not less than ``upper_bound``.
+
+            .. doctest::
+
+               >>> from libsemigroups_pybind11 import wilo_split
+               >>> wilo_split(2, 3, [], [1, 1, 1], 1)
+               [([], [1]), ([1], [1, 1, 1])]
+          )pbdoc");
+
     ////////////////////////////////////////////////////////////////////////
     // wislo.hpp
     ////////////////////////////////////////////////////////////////////////
@@ -191,6 +575,76 @@ namespace libsemigroups {
              [[0], [1], [0, 0], [0, 1], [1, 0]]
         )pbdoc");
 
+    m.def(
+        "wislo_chunks",
+        [](size_t const     n,
+           word_type const& first,
+           word_type const& last,
+           size_t           chunk_size) {
+          return make_path_chunks(cbegin_wislo(n, first, last),
+                                  cend_wislo(n, first, last),
+                                  chunk_size);
+        },
+        py::arg("n"),
+        py::arg("first"),
+        py::arg("last"),
+        py::arg("chunk_size") = 4096,
+        R"pbdoc(
+          Returns an iterator yielding chunks of the words in short-lex order
+          (wislo).
+
+          See :py:func:`wilo_chunks` for the format of the chunks. This is
+          equivalent to, but much faster than, :py:func:`wislo`.
+
+          :param n: the number of letters
+          :type n: int
+          :param first: the first word
+          :type first: list
+          :param last: one past the last word
+          :type last: list
+          :param chunk_size:
+            the maximum number of words in a chunk (default: ``4096``)
+          :type chunk_size: int
+
+          :return: An iterator.
+        )pbdoc");
+
+    m.def("wislo_split",
+          &wislo_split,
+          py::arg("n"),
+          py::arg("first"),
+          py::arg("last"),
+          py::arg("prefix_length"),
+          R"pbdoc(
+            Split a range of words in short-lex order by length and prefix.
+
+            Returns a list of pairs ``(u, v)`` such that the ranges
+            ``wislo(n, u, v)`` are disjoint, and contain (in order) the words
+            in ``wislo(n, first, last)``. The words in each range have the
+            same length, and the same prefix of length ``prefix_length`` (or
+            are equal to such a prefix). The ranges can be enumerated
+            independently, for example in different processes, and the
+            number of words in each range of words of length :math:`m` is at
+            most :math:`n ^ {m - k}`, where :math:`k` is ``prefix_length``.
+
+            :param n: the number of letters
+            :type n: int
+            :param first: the first word
+            :type first: list
+            :param last: one past the last word
+            :type last: list
+            :param prefix_length: the length of the prefixes
+            :type prefix_length: int
+
+            :return: A list of pairs of words.
+
+            .. doctest::
+
+               >>> from libsemigroups_pybind11 import wislo_split
+               >>> wislo_split(2, [], [0, 0], 1)
+               [([], [0]), ([0], [1]), ([1], [0, 0])]
+          )pbdoc");
+
     ////////////////////////////////////////////////////////////////////////
     // words.hpp
     ////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,29 @@
+# -*- coding: utf-8 -*-
+
+# Copyright (c) 2023, J. D. Mitchell
+#
+# Distributed under the terms of the GPL license version 3.
+#
+# The full license is in the file LICENSE, distributed with this software.
+
+"""
+This module contains some helpers for testing the *_chunks functions.
+"""
+
+# pylint: disable=no-name-in-module, missing-function-docstring, invalid-name
+
+
+def unchunk(chunks):
+    "Returns the list of words stored in chunks of (offsets, letters, ...)."
+    result = []
+    for chunk in chunks:
+        offsets, letters = chunk[0], chunk[1]
+        assert offsets[0] == 0
+        assert offsets[-1] == len(letters)
+        for i in range(len(offsets) - 1):
+            word = letters[offsets[i] : offsets[i + 1]]
+            if isinstance(word, bytes):
+                result.append(word.decode())
+            else:
+                result.append(word.tolist())
+    return result
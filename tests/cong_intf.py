@@ -0,0 +1,45 @@
+# -*- coding: utf-8 -*-
+
+# Copyright (c) 2023, J. D. Mitchell
+#
+# Distributed under the terms of the GPL license version 3.
+#
+# The full license is in the file LICENSE, distributed with this software.
+
+"""
+This module contains some congruences used in tests for CongruenceInterface
+derived classes, i.e. ToddCoxeter, Congruence, etc.
+"""
+
+# pylint: disable=no-name-in-module, missing-function-docstring, invalid-name
+
+from libsemigroups_pybind11 import ToddCoxeter, congruence_kind
+
+
+def add_10752_pairs(x):
+    "Defines on x a presentation of a monoid with 10752 elements."
+    x.set_number_of_generators(4)
+    x.add_pair([0, 0], [0])
+    x.add_pair([1, 0], [1])
+    x.add_pair([0, 1], [1])
+    x.add_pair([2, 0], [2])
+    x.add_pair([0, 2], [2])
+    x.add_pair([3, 0], [3])
+    x.add_pair([0, 3], [3])
+    x.add_pair([1, 1], [0])
+    x.add_pair([2, 3], [0])
+    x.add_pair([2, 2, 2], [0])
+    x.add_pair([1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2], [0])
+    x.add_pair(
+        [1, 2, 1, 3, 1, 2, 1, 3, 1, 2, 1, 3, 1, 2, 1, 3]
+        + [1, 2, 1, 3, 1, 2, 1, 3, 1, 2, 1, 3, 1, 2, 1, 3],
+        [0],
+    )
+    return x
+
+
+def make_10752(strat=ToddCoxeter.strategy_options.hlt):
+    "Returns a ToddCoxeter for the monoid in add_10752_pairs using strat."
+    tc = add_10752_pairs(ToddCoxeter(congruence_kind.twosided))
+    tc.strategy(strat)
+    return tc
@@ -15,6 +15,8 @@ derived classes, i.e. KnuthBendix, FpSemigroup, etc.
 
 from datetime import timedelta
 
+import pytest
+
 from libsemigroups_pybind11 import ReportGuard
 
 n = 0
@@ -59,3 +61,56 @@ def check_runner(x, t=timedelta(microseconds=1000)):
     assert x.started()
     assert x.stopped_by_predicate()
     assert not x.timed_out()
+
+    def raises():
+        raise ValueError("stop!")
+
+    with pytest.raises(ValueError):
+        x.run_until(raises)
+
+    assert x.stopped()
+    assert not x.finished()
+    assert not x.running()
+
+    n = 0
+    x.run_until(func, timedelta(microseconds=100))
+
+    assert x.stopped()
+    assert not x.finished()
+    assert x.stopped_by_predicate()
+
+
+def check_run_with_stats(make, keys):
+    ReportGuard(False)
+    keys = set(keys) | {"finished"}
+    x = make()
+    assert set(x.stats()) == keys
+    assert not x.stats()["finished"]
+
+    calls = []
+    x.run_with_stats(calls.append, timedelta(0))
+    assert x.finished()
+    assert len(calls) >= 2
+    assert all(set(d) == keys | {"elapsed"} for d in calls)
+    assert calls[-1]["finished"]
+    assert not calls[0]["finished"]
+    elapsed = [d["elapsed"] for d in calls]
+    assert elapsed == sorted(elapsed)
+    assert x.stats()["finished"]
+
+    calls = []
+    x = make()
+    x.run_with_stats(
+        lambda d: calls.append(d) or len(calls) >= 2, timedelta(0)
+    )
+    assert x.stopped_by_predicate()
+    assert not x.finished()
+    assert len(calls) >= 3
+
+    def raises(_):
+        raise ValueError("stop!")
+
+    x = make()
+    with pytest.raises(ValueError):
+        x.run_with_stats(raises)
+    assert not x.finished()
@@ -14,7 +14,12 @@ libsemigroups_pybind11.
 # pylint: disable=no-name-in-module, missing-function-docstring, invalid-name,
 # pylint: disable=duplicate-code, too-many-lines
 
+from multiprocessing import shared_memory
+from threading import Thread
+
+import numpy as np
 import pytest
+from chunks import unchunk
 from libsemigroups_pybind11 import (
     POSITIVE_INFINITY,
     UNDEFINED,
@@ -918,3 +923,217 @@ def test_dot():
         str(action_digraph_helper.dot(d))
         == 'digraph {\n\tnode [shape=box]\n\t0\n\t1\n\t2\n\t3\n\t0 -> 0 [label=0 color="#cc6677"]\n\t0 -> 0 [label=1 color="#ddcc77"]\n\t0 -> 0 [label=2 color="#117733"]\n\t0 -> 0 [label=3 color="#88ccee"]\n\t0 -> 0 [label=4 color="#44aa99"]\n\t0 -> 0 [label=5 color="#882255"]\n\t0 -> 0 [label=6 color="#44aa99"]\n\t0 -> 0 [label=7 color="#999933"]\n\t0 -> 0 [label=8 color="#332288"]\n\t0 -> 0 [label=9 color="#cc6677"]\n\t0 -> 0 [label=10 color="#ddcc77"]\n\t0 -> 0 [label=11 color="#117733"]\n\t1 -> 1 [label=0 color="#cc6677"]\n\t1 -> 1 [label=1 color="#ddcc77"]\n\t1 -> 1 [label=2 color="#117733"]\n\t1 -> 1 [label=3 color="#88ccee"]\n\t1 -> 1 [label=4 color="#44aa99"]\n\t1 -> 1 [label=5 color="#882255"]\n\t1 -> 1 [label=6 color="#44aa99"]\n\t1 -> 1 [label=7 color="#999933"]\n\t1 -> 1 [label=8 color="#332288"]\n\t1 -> 1 [label=9 color="#cc6677"]\n\t1 -> 1 [label=10 color="#ddcc77"]\n\t1 -> 1 [label=11 color="#117733"]\n\t2 -> 2 [label=0 color="#cc6677"]\n\t2 -> 2 [label=1 color="#ddcc77"]\n\t2 -> 2 [label=2 color="#117733"]\n\t2 -> 2 [label=3 color="#88ccee"]\n\t2 -> 2 [label=4 color="#44aa99"]\n\t2 -> 2 [label=5 color="#882255"]\n\t2 -> 2 [label=6 color="#44aa99"]\n\t2 -> 2 [label=7 color="#999933"]\n\t2 -> 2 [label=8 color="#332288"]\n\t2 -> 2 [label=9 color="#cc6677"]\n\t2 -> 2 [label=10 color="#ddcc77"]\n\t2 -> 2 [label=11 color="#117733"]\n\t3 -> 3 [label=0 color="#cc6677"]\n\t3 -> 3 [label=1 color="#ddcc77"]\n\t3 -> 3 [label=2 color="#117733"]\n\t3 -> 3 [label=3 color="#88ccee"]\n\t3 -> 3 [label=4 color="#44aa99"]\n\t3 -> 3 [label=5 color="#882255"]\n\t3 -> 3 [label=6 color="#44aa99"]\n\t3 -> 3 [label=7 color="#999933"]\n\t3 -> 3 [label=8 color="#332288"]\n\t3 -> 3 [label=9 color="#cc6677"]\n\t3 -> 3 [label=10 color="#ddcc77"]\n\t3 -> 3 [label=11 color="#117733"]\n}\n'  # pylint: disable=line-too-long
     )
+
+
+def test_table():
+    d = ActionDigraph(3, 2)
+    d.add_edge(0, 1, 0)
+    d.add_edge(1, 2, 1)
+    t = d.table()
+    assert t.shape == (3, 2)
+    assert not t.flags.writeable
+    assert t.tolist() == [
+        [1, UNDEFINED],
+        [UNDEFINED, 2],
+        [UNDEFINED, UNDEFINED],
+    ]
+    with pytest.raises(ValueError):
+        t[0][0] = 2
+
+    # The view is not a copy
+    d.add_edge(2, 0, 0)
+    assert t[2][0] == 0
+
+    assert np.array_equal(np.asarray(d), t)
+    assert not np.asarray(d).flags.writeable
+
+    # The view keeps the digraph alive
+    d = binary_tree(4)
+    t = d.table()
+    del d
+    assert t[0].tolist() == [1, 2]
+
+    assert ActionDigraph().table().shape == (0, 0)
+    assert np.asarray(ActionDigraph(2, 0)).shape == (2, 0)
+
+
+def test_table_exports():
+    d = binary_tree(3)
+    t = d.table()
+    with pytest.raises(RuntimeError):
+        d.add_nodes(1)
+    with pytest.raises(RuntimeError):
+        d.add_to_out_degree(1)
+    with pytest.raises(RuntimeError):
+        d.reserve(100, 100)
+    with pytest.raises(RuntimeError):
+        add_cycle(d, 3)
+    d.add_edge(1, 0, 0)
+    del t
+
+    m = memoryview(d)
+    with pytest.raises(RuntimeError):
+        d.add_nodes(1)
+    m.release()
+
+    d.add_nodes(1)
+    d.add_to_out_degree(1)
+    assert d.table().shape == (8, 3)
+
+
+def test_from_table():
+    d = binary_tree(5)
+    assert ActionDigraph(d.table()) == d
+    assert ActionDigraph(np.asarray(d)) == d
+    l = [[0, 1], [1, 18446744073709551615]]
+    assert ActionDigraph(l) == action_digraph_helper.make(2, l)
+
+    shm = shared_memory.SharedMemory(create=True, size=d.table().nbytes)
+    try:
+        t = np.ndarray(d.table().shape, dtype=np.uint64, buffer=shm.buf)
+        t[:] = d.table()
+        assert ActionDigraph(t) == d
+        del t
+    finally:
+        shm.close()
+        shm.unlink()
+
+    with pytest.raises(RuntimeError):
+        ActionDigraph(np.array([0, 1], dtype=np.uint64))
+    with pytest.raises(RuntimeError):
+        ActionDigraph([[0, 2], [1, 0]])
+
+
+def test_path_chunks():
+    d = binary_tree(4)
+    for mx in (5, POSITIVE_INFINITY):
+        assert unchunk(d.pilo_chunks(0, 0, mx, chunk_size=3)) == list(
+            d.pilo_iterator(0, 0, mx)
+        )
+        assert unchunk(d.pislo_chunks(0, 1, mx, chunk_size=4)) == list(
+            d.pislo_iterator(0, 1, mx)
+        )
+        assert unchunk(d.pstilo_chunks(0, 7, 0, mx, chunk_size=1)) == list(
+            d.pstilo_iterator(0, 7, 0, mx)
+        )
+        assert unchunk(d.pstislo_chunks(0, 9, 0, mx)) == list(
+            d.pstislo_iterator(0, 9, 0, mx)
+        )
+
+        expected = list(d.panilo_iterator(0, 0, mx))
+        chunks = list(d.panilo_chunks(0, 0, mx, chunk_size=2))
+        assert unchunk(chunks) == [x[0] for x in expected]
+        assert sum((c[2].tolist() for c in chunks), []) == [
+            x[1] for x in expected
+        ]
+        expected = list(d.panislo_iterator(0, 0, mx))
+        chunks = list(d.panislo_chunks(0, 0, mx, chunk_size=5))
+        assert unchunk(chunks) == [x[0] for x in expected]
+        assert sum((c[2].tolist() for c in chunks), []) == [
+            x[1] for x in expected
+        ]
+
+    assert unchunk(d.pilo_chunks(0)) == list(
+        d.pilo_iterator(0, 0, POSITIVE_INFINITY)
+    )
+    assert unchunk(d.pislo_chunks(0, max=POSITIVE_INFINITY)) == list(
+        d.pislo_iterator(0, 0, POSITIVE_INFINITY)
+    )
+    assert unchunk(d.pstilo_chunks(0, 7)) == list(
+        d.pstilo_iterator(0, 7, 0, POSITIVE_INFINITY)
+    )
+    assert unchunk(d.pstislo_chunks(0, 9, max=3)) == list(
+        d.pstislo_iterator(0, 9, 0, 3)
+    )
+    assert unchunk(d.panilo_chunks(0)) == [
+        x[0] for x in d.panilo_iterator(0, 0, POSITIVE_INFINITY)
+    ]
+    assert unchunk(d.panislo_chunks(0, 2)) == [
+        x[0] for x in d.panislo_iterator(0, 2, POSITIVE_INFINITY)
+    ]
+
+    it = d.pislo_chunks(0, 0, 5, chunk_size=4)
+    assert it.chunk_size() == 4
+    assert not it.exhausted()
+    offsets, letters = it.next(10)
+    assert len(offsets) == 11
+    assert letters.dtype == np.uint64
+    assert len(unchunk(it)) == len(list(d.pislo_iterator(0, 0, 5))) - 10
+    assert it.exhausted()
+    assert len(it.next(10)[0]) == 1
+    with pytest.raises(StopIteration):
+        next(it)
+
+    it = d.pilo_chunks(0, 0, 5)
+    del d
+    assert len(unchunk(it)) == 15
+
+
+def test_number_of_paths_many():
+    algorithm = ActionDigraph.algorithm
+    d = binary_tree(6)
+    add_cycle(d, 5)
+    d.add_edge(62, 63, 0)
+    n = d.number_of_nodes()
+    sources = list(range(n))
+    for mx in (4, 10, POSITIVE_INFINITY):
+        expected = [d.number_of_paths(s, 1, mx) for s in sources]
+        for max_threads in (1, 3, 0):
+            result = d.number_of_paths_many(
+                sources, 1, mx, max_threads=max_threads
+            )
+            assert result.dtype == np.uint64
+            assert result.tolist() == expected
+
+    for mx in (4, 10):
+        expected = [d.number_of_paths(s, 63, 0, mx) for s in sources]
+        result = d.number_of_paths_many(sources, 63, 0, mx, max_threads=4)
+        assert result.tolist() == expected
+
+    expected = [d.number_of_paths(s, 0, 4, algorithm.dfs) for s in sources]
+    assert (
+        d.number_of_paths_many(sources, 0, 4, algorithm.dfs, 2).tolist()
+        == expected
+    )
+    sources = np.array([[0, 1], [2, 62]], dtype=np.uint64)
+    assert d.number_of_paths_many(sources, 0, 3).shape == (2, 2)
+    assert not d.number_of_paths_many([], 0, 3).tolist()
+
+    with pytest.raises(RuntimeError):
+        d.number_of_paths_many([0, n], 0, 3, max_threads=2)
+    with pytest.raises(RuntimeError):
+        d.number_of_paths_many([0, 1], 0, 3, algorithm.acyclic)
+
+
+def test_scc_ids():
+    j = 7
+    graph = ActionDigraph()
+    graph.add_to_out_degree(1)
+    for k in range(5):
+        graph.add_nodes(j)
+        for i in range(k * j, (k + 1) * j - 1):
+            graph.add_edge(i, i + 1, 0)
+        graph.add_edge((k + 1) * j - 1, k * j, 0)
+    ids = graph.scc_ids()
+    assert ids.tolist() == [graph.scc_id(i) for i in range(5 * j)]
+    assert ids.tolist() == [i // j for i in range(5 * j)]
+    assert ActionDigraph(0, 1).scc_ids().size == 0
+
+
+def test_scc_threads():
+    d = binary_tree(12)
+    add_cycle(d, 100)
+    last = d.number_of_nodes() - 1
+    results = [None] * 4
+
+    def scc_ids(i):
+        results[i] = (d.scc_ids().tolist(), d.spanning_forest().parent(last))
+
+    threads = [Thread(target=scc_ids, args=(i,)) for i in range(4)]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+    expected = (d.scc_ids().tolist(), d.spanning_forest().parent(last))
+    for result in results:
+        assert result == expected
@@ -13,6 +13,7 @@ This module contains some tests for bipartitions.
 # pylint: disable=no-name-in-module, missing-function-docstring, invalid-name
 
 from itertools import chain
+import pickle
 
 import pytest
 from element import check_products
@@ -83,3 +84,14 @@ def test_iterators():
     assert list(x.right_blocks()) == [3, 0, 2]
 
     assert x.lookup() == [True, False, True]
+
+
+def test_pickle():
+    for x in (
+        Bipartition.make([0, 1, 2, 3, 0, 2]),
+        Bipartition.make([0] * 16),
+        Bipartition.make([0, 1, 2, 3, 0, 2]).identity(),
+    ):
+        y = pickle.loads(pickle.dumps(x))
+        assert y == x
+        assert y is not x
@@ -0,0 +1,142 @@
+# -*- coding: utf-8 -*-
+
+# Copyright (c) 2023, J. D. Mitchell
+#
+# Distributed under the terms of the GPL license version 3.
+#
+# The full license is in the file LICENSE, distributed with this software.
+
+# pylint: disable=no-name-in-module, missing-function-docstring, invalid-name
+
+"""
+This module contains some tests for CancellationToken.
+"""
+
+import copy
+import os
+import signal
+import sys
+import time
+from threading import Thread, Timer
+
+import pytest
+from cong_intf import add_10752_pairs, make_10752
+
+from libsemigroups_pybind11 import (
+    CancellationToken,
+    Congruence,
+    KnuthBendix,
+    ReportGuard,
+    ToddCoxeter,
+    congruence_kind,
+)
+
+
+def make_infinite():
+    tc = ToddCoxeter(congruence_kind.twosided)
+    tc.set_number_of_generators(1)
+    return tc
+
+
+def make_knuth_bendix():
+    kb = KnuthBendix()
+    kb.set_alphabet("abce")
+    kb.set_identity("e")
+    kb.add_rule("aa", "e")
+    kb.add_rule("bc", "e")
+    kb.add_rule("bbb", "e")
+    kb.add_rule("ababababababab", "e")
+    kb.add_rule("abacabacabacabacabacabacabacabac", "e")
+    return kb
+
+
+def test_token():
+    token = CancellationToken()
+    assert not token.cancelled()
+    other = copy.copy(token)
+    token.cancel()
+    assert token.cancelled()
+    assert other.cancelled()
+    other.reset()
+    assert not token.cancelled()
+    assert not CancellationToken().cancelled()
+
+
+def test_run_until_token():
+    ReportGuard(False)
+    token = CancellationToken()
+    token.cancel()
+    tc = make_10752()
+    tc.run_until(token)
+    assert tc.stopped_by_predicate()
+    assert not tc.finished()
+
+    token.reset()
+    tc.run_until(token)
+    assert tc.finished()
+    assert tc.number_of_classes() == 10752
+
+
+def test_cancel_from_another_thread():
+    ReportGuard(False)
+    token = CancellationToken()
+    runners = [
+        make_10752(),
+        add_10752_pairs(Congruence(congruence_kind.twosided)),
+        make_knuth_bendix(),
+    ]
+    threads = [Thread(target=x.run_until, args=(token,)) for x in runners]
+    for t in threads:
+        t.start()
+    time.sleep(0.001)
+    token.cancel()
+    for t in threads:
+        t.join()
+    for x in runners:
+        assert x.stopped_by_predicate() or x.finished()
+
+
+@pytest.mark.skipif(
+    not hasattr(signal, "SIGUSR1"), reason="SIGUSR1 is not available"
+)
+def test_cancel_on_signal():
+    ReportGuard(False)
+    token = CancellationToken()
+    old = signal.getsignal(signal.SIGUSR1)
+    previous = token.cancel_on_signal(signal.SIGUSR1)
+    try:
+        assert previous == old
+        assert signal.getsignal(signal.SIGUSR1) != old
+        os.kill(os.getpid(), signal.SIGUSR1)
+        assert token.cancelled()
+
+        token.reset()
+        tc = make_infinite()
+        timer = Timer(0.01, os.kill, (os.getpid(), signal.SIGUSR1))
+        timer.start()
+        tc.run_until(token)
+        timer.join()
+        assert token.cancelled()
+        assert tc.stopped_by_predicate()
+    finally:
+        signal.signal(signal.SIGUSR1, previous)
+    assert signal.getsignal(signal.SIGUSR1) == old
+
+    with pytest.raises(ValueError):
+        token.cancel_on_signal(-1)
+
+
+@pytest.mark.skipif(
+    sys.platform == "win32", reason="os.kill cannot send SIGINT on Windows"
+)
+def test_keyboard_interrupt():
+    ReportGuard(False)
+    token = CancellationToken()
+    tc = make_infinite()
+    timer = Timer(0.01, os.kill, (os.getpid(), signal.SIGINT))
+    timer.start()
+    with pytest.raises(KeyboardInterrupt):
+        tc.run_until(token)
+    timer.join()
+    assert not token.cancelled()
+    assert not tc.finished()
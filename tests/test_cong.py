@@ -49,3 +49,21 @@ def test_018():
     # The next line does nothing except check that it's possible to call
     # `run_for` with a timedelta
     cong.run_for(timedelta(seconds=1))
+
+
+def test_batch_word_to_class_index():
+    ReportGuard(False)
+    cong = Congruence(congruence_kind.twosided)
+    cong.set_number_of_generators(2)
+    cong.add_pair([0, 0, 0], [0])
+    cong.add_pair([1, 1], [1])
+    cong.add_pair([0, 1, 0], [0, 0])
+    words = [[0], [1], [0, 0, 0], [0, 1, 0], [0, 0], [1, 1, 1]]
+    expected = [cong.word_to_class_index(w) for w in words]
+    assert list(cong.word_to_class_indices(words)) == expected
+    offsets = [0, 1, 2, 5, 8, 10, 13]
+    letters = [0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1]
+    assert list(cong.word_to_class_indices(offsets, letters)) == expected
+    assert list(cong.contains_many(words[:3], words[3:])) == [
+        cong.contains(u, v) for u, v in zip(words[:3], words[3:])
+    ]
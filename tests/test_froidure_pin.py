@@ -13,8 +13,12 @@ This module contains some tests for FroidurePin
 """
 
 from datetime import timedelta
+import pickle
+from threading import Thread
+
+import numpy as np
 import pytest
-from runner import check_runner
+from runner import check_run_with_stats, check_runner
 
 from _libsemigroups_pybind11 import (
     Transf16,
@@ -188,9 +192,26 @@ def check_cayley_graphs(S):
     g = S.right_cayley_graph()
     assert len(g) == S.size()
     assert len(g[0]) == S.number_of_generators()
+    assert g.shape == (S.size(), S.number_of_generators())
+    assert not g.flags.writeable
+    assert all(
+        g[i][j] == S.fast_product(i, S.current_position(S.generator(j)))
+        for i in range(min(S.size(), 100))
+        for j in range(S.number_of_generators())
+    )
+    with pytest.raises(ValueError):
+        g[0][0] = 0
+
     g = S.left_cayley_graph()
     assert len(g) == S.size()
     assert len(g[0]) == S.number_of_generators()
+    assert g.shape == (S.size(), S.number_of_generators())
+    assert not g.flags.writeable
+    assert all(
+        g[i][j] == S.fast_product(S.current_position(S.generator(j)), i)
+        for i in range(min(S.size(), 100))
+        for j in range(S.number_of_generators())
+    )
 
 
 def check_factor_prod_rels(S):
@@ -272,6 +293,50 @@ def check_froidure_pin_transf1(T):
         assert S.degree() == 8
 
 
+def check_batch(S):
+    ReportGuard(False)
+    S.run()
+    n = min(S.size(), 30)
+    pos = list(range(n))
+    elts = [S.at(i) for i in pos]
+    words = [S.factorisation(i) for i in pos]
+
+    assert list(S.current_positions(words)) == pos
+    assert list(S.current_positions(elts)) == pos
+    assert list(S.positions(elts)) == pos
+    assert S.factorisations(pos) == words
+    assert list(S.lengths(pos)) == [S.length(i) for i in pos]
+    assert list(S.prefixes(pos)) == [S.prefix(i) for i in pos]
+    assert list(S.suffixes(pos)) == [S.suffix(i) for i in pos]
+
+    i = np.array([[a] * n for a in pos])
+    j = i.transpose()
+    prod = S.fast_products(i, j)
+    assert prod.shape == (n, n)
+    assert all(prod[a][b] == S.fast_product(a, b) for a in pos for b in pos)
+    assert np.array_equal(S.products_by_reduction(i, j), prod)
+
+    with pytest.raises(RuntimeError):
+        S.fast_products([0, 1], [0])
+    with pytest.raises(RuntimeError):
+        S.lengths([S.size()])
+    for f in (S.fast_products, S.products_by_reduction):
+        with pytest.raises(RuntimeError):
+            f([-1], [0])
+        with pytest.raises(RuntimeError):
+            f([0], np.array([0.5]))
+        with pytest.raises(RuntimeError):
+            f([0], [S.current_size()])
+    for f in (S.prefixes, S.suffixes):
+        with pytest.raises(RuntimeError):
+            f([S.current_size()])
+    for f in (S.lengths, S.factorisations, S.prefixes, S.suffixes):
+        with pytest.raises(RuntimeError):
+            f([-1])
+        with pytest.raises(RuntimeError):
+            f(np.array([1.0]))
+
+
 def check_froidure_pin_transf2(T):
     add = list(range(3, 16)) if T is Transf16 else []
     gens = [
@@ -315,6 +380,7 @@ def checks_for_froidure_pin():
         check_cayley_graphs,
         check_factor_prod_rels,
         check_prefix_suffix,
+        check_batch,
     )
 
 
@@ -351,6 +417,33 @@ def test_runner_transf():
         check_runner(S, timedelta(microseconds=1000))
 
 
+def test_run_with_stats():
+    def make():
+        S = FroidurePin(Transf1.make([1, 7, 2, 6, 0, 4, 1, 5]))
+        S.add_generator(Transf1.make([2, 4, 6, 1, 4, 5, 2, 7]))
+        S.add_generator(Transf1.make([3, 0, 7, 2, 4, 6, 2, 4]))
+        S.add_generator(Transf1.make([3, 2, 3, 4, 5, 3, 0, 1]))
+        S.add_generator(Transf1.make([4, 3, 7, 7, 4, 5, 0, 4]))
+        return S
+
+    check_run_with_stats(
+        make,
+        (
+            "current_size",
+            "current_number_of_rules",
+            "current_max_word_length",
+        ),
+    )
+    S = make()
+    S.run()
+    stats = S.stats()
+    assert stats["current_size"] == S.size()
+    assert stats["current_number_of_rules"] == S.current_number_of_rules()
+    assert stats["current_max_word_length"] == max(
+        len(S.factorisation(i)) for i in range(S.size())
+    )
+
+
 def test_froidure_pin_pperm(checks_for_froidure_pin, checks_for_generators):
     for T in (PPerm16, PPerm1, PPerm2, PPerm4):
         gens = [
@@ -586,3 +679,184 @@ def test_froidure_pin_ntp(checks_for_froidure_pin, checks_for_generators):
 
     for check in checks_for_froidure_pin:
         check(FroidurePin(gens))
+
+
+def test_froidure_pin_pickle():
+    ReportGuard(False)
+    S = FroidurePin(Transf1.make([1, 0, 2, 3]), Transf1.make([1, 2, 3, 0]))
+    S.enumerate(10)
+    T = pickle.loads(pickle.dumps(S))
+    assert type(T) is type(S)
+    assert T.current_size() >= S.current_size()
+    assert T.generator(0) == S.generator(0)
+    assert T.generator(1) == S.generator(1)
+
+    S.run()
+    T = pickle.loads(pickle.dumps(S))
+    assert T.finished()
+    assert list(T) == list(S)
+    assert T.number_of_rules() == S.number_of_rules()
+
+    S = FroidurePin(BMat8([[0, 1], [1, 0]]), BMat8([[1, 1], [0, 1]]))
+    T = pickle.loads(pickle.dumps(S))
+    assert T.size() == S.size()
+
+    for gens in (
+        [PBR.make([[], [0, 3], [1], [2]]), PBR.make([[1], [0], [3], [2]])],
+        [
+            Bipartition.make([0, 1, 1, 0]),
+            Bipartition.make([0, 1, 2, 1]),
+        ],
+        [
+            Matrix(MatrixKind.MaxPlusTrunc, 5, [[0, 1], [1, 0]]),
+            Matrix(MatrixKind.MaxPlusTrunc, 5, [[1, 1], [0, 2]]),
+        ],
+        [
+            Matrix(MatrixKind.NTP, 5, 7, [[0, 1], [1, 0]]),
+            Matrix(MatrixKind.NTP, 5, 7, [[1, 1], [0, 2]]),
+        ],
+        [
+            Matrix(MatrixKind.Boolean, [[0, 1], [1, 0]]),
+            Matrix(MatrixKind.Boolean, [[1, 0], [1, 1]]),
+        ],
+        [
+            Matrix(MatrixKind.Integer, [[0, 1], [1, 0]]),
+            Matrix(MatrixKind.Integer, [[1, 0], [0, 0]]),
+        ],
+    ):
+        S = FroidurePin(gens)
+        T = pickle.loads(pickle.dumps(S))
+        assert T.size() == S.size()
+        assert list(T) == list(S)
+
+    kb = KnuthBendix()
+    kb.set_alphabet("ab")
+    kb.add_rule("aa", "a")
+    kb.add_rule("bb", "b")
+    kb.add_rule("ab", "ba")
+    with pytest.raises(TypeError):
+        pickle.dumps(kb.froidure_pin())
+    tc = ToddCoxeter(congruence_kind.twosided)
+    tc.set_number_of_generators(1)
+    tc.add_pair([0, 0], [0])
+    with pytest.raises(TypeError):
+        pickle.dumps(tc.quotient_froidure_pin())
+
+
+def test_add_generators_incremental():
+    ReportGuard(False)
+    S = FroidurePin(Transf1.make([1, 2, 3, 4, 0]))
+    S.run()
+    assert S.size() == 5
+
+    T = S.copy_add_generators([Transf1.make([1, 0, 2, 3, 4])])
+    assert T.size() == 120
+    assert S.size() == 5
+    assert S.number_of_generators() == 1
+    assert all(T.contains(x) for x in S)
+
+    U = T.copy_closure([Transf1.make([0, 0, 2, 3, 4])])
+    assert U.size() == 3125
+    assert T.size() == 120
+
+    results = []
+
+    def extend(x):
+        V = S.copy_add_generators([Transf1.make([1, 0, 2, 3, 4])])
+        V.add_generators([x])
+        results.append(V.size())
+
+    threads = [
+        Thread(target=extend, args=(Transf1.make([0, 0, 2, 3, 4]),)),
+        Thread(target=extend, args=(Transf1.make([0, 1, 2, 3, 0]),)),
+    ]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    assert results == [3125, 3125]
+
+
+def test_copy_add_generators_many():
+    ReportGuard(False)
+    S = FroidurePin(Transf1.make([1, 2, 3, 4, 0]))
+    colls = [
+        [Transf1.make([1, 0, 2, 3, 4])],
+        [Transf1.make([0, 0, 2, 3, 4])],
+        [Transf1.make([1, 0, 2, 3, 4]), Transf1.make([0, 0, 2, 3, 4])],
+        [],
+    ]
+    expected = [S.copy_add_generators(coll).size() for coll in colls]
+    assert expected[0] == 120
+    assert expected[2] == 3125
+    for max_threads in (1, 2, 0):
+        result = S.copy_add_generators_many(colls, max_threads)
+        assert [T.size() for T in result] == expected
+        assert all(T.finished() for T in result)
+        result = S.copy_closure_many(colls, max_threads)
+        assert [T.size() for T in result] == expected
+        assert result[2].number_of_generators() == 3
+    assert S.number_of_generators() == 1
+    assert not S.copy_add_generators_many([], 2)
+
+
+def test_subsemigroup_positions():
+    ReportGuard(False)
+    gens = [
+        Transf1.make([1, 2, 3, 4, 0]),
+        Transf1.make([1, 0, 2, 3, 4]),
+        Transf1.make([0, 0, 2, 3, 4]),
+    ]
+    S = FroidurePin(gens)
+    for subset in ([0], [1], [0, 1], [2, 0], [0, 1, 2], [1, 1]):
+        positions = S.subsemigroup_positions(subset)
+        assert positions.tolist() == sorted(positions.tolist())
+        T = FroidurePin([gens[i] for i in subset])
+        assert sorted(S.at(int(i)) for i in positions) == sorted(T)
+    assert not S.subsemigroup_positions([]).tolist()
+    with pytest.raises(RuntimeError):
+        S.subsemigroup_positions([3])
+
+
+def test_idempotent_indices_and_sorted_positions():
+    ReportGuard(False)
+    S = FroidurePin(Transf1.make([1, 0, 2, 3]), Transf1.make([1, 2, 3, 0]))
+    idem = S.idempotent_indices()
+    assert isinstance(idem, np.ndarray)
+    assert not idem.flags.writeable
+    assert list(idem) == [i for i in range(S.size()) if S.is_idempotent(i)]
+    assert len(idem) == S.number_of_idempotents()
+    assert S.idempotent_indices() is idem
+
+    srt = S.sorted_positions()
+    assert not srt.flags.writeable
+    assert [S.at(i) for i in srt] == list(S.sorted())
+    assert all(S.position_to_sorted_position(i) == j for j, i in enumerate(srt))
+    assert S.sorted_positions() is srt
+
+    S.add_generators([Transf1.make([0, 0, 2, 3])])
+    assert S.idempotent_indices() is not idem
+    assert len(S.idempotent_indices()) == S.number_of_idempotents()
+    assert len(S.sorted_positions()) == S.size() == 256
+
+
+def test_cayley_graph_exports():
+    ReportGuard(False)
+    S = FroidurePin(Transf1.make([1, 0, 2, 3]), Transf1.make([1, 2, 3, 0]))
+    g = S.right_cayley_graph()
+    h = S.left_cayley_graph()[1:]
+    x = Transf1.make([0, 0, 2, 3])
+    with pytest.raises(RuntimeError):
+        S.add_generator(x)
+    with pytest.raises(RuntimeError):
+        S.add_generators([x])
+    with pytest.raises(RuntimeError):
+        S.closure([x])
+    with pytest.raises(RuntimeError):
+        S.reserve(1000)
+    del g
+    with pytest.raises(RuntimeError):
+        S.add_generators([x])
+    del h
+    S.add_generators([x])
+    assert S.right_cayley_graph().shape == (256, 3)
@@ -12,6 +12,8 @@ This module contains some tests for the Presentation class.
 # pylint: disable=fixme, missing-function-docstring
 # pylint: disable=missing-class-docstring, invalid-name
 
+import pytest
+
 from libsemigroups_pybind11 import (
     POSITIVE_INFINITY,
     Kambites,
@@ -292,3 +294,34 @@ def test_case_010():
         len([x for x in sislo("cab", "cccc", "ccccc") if k.equal_to(x, "acba")])
         == 2
     )
+
+
+def test_equal_to_many_and_normal_form_many():
+    ReportGuard(False)
+    k = Kambites()
+    k.set_alphabet("cab")
+    k.add_rule("aabc", "acba")
+
+    us = list(sislo("cab", "a", "aaaaa"))
+    vs = us[1:] + us[:1]
+    expected = [k.equal_to(u, v) for u, v in zip(us, vs)]
+    nfs = [k.normal_form(u) for u in us]
+    for max_threads in (1, 4, 0):
+        assert k.equal_to_many(us, vs, max_threads).tolist() == expected
+        assert k.equal_to_many(us, us, max_threads).all()
+        assert k.normal_form_many(us, max_threads) == nfs
+
+    ws = [k.string_to_word(u) for u in us]
+    assert k.equal_to_many(ws, ws[1:] + ws[:1], 4).tolist() == expected
+    assert k.normal_form_many(ws, 4) == [k.string_to_word(w) for w in nfs]
+
+    assert k.normal_form_many([]) == []
+    assert len(k.equal_to_many([], [])) == 0
+    with pytest.raises(RuntimeError):
+        k.equal_to_many(us, vs[1:])
+
+    k = Kambites()
+    k.set_alphabet("ab")
+    k.add_rule("ab", "ba")
+    with pytest.raises(RuntimeError):
+        k.equal_to_many(["ab"], ["ba"])
@@ -12,8 +12,13 @@ This module contains some tests for KnuthBendix.
 
 # pylint: disable=no-name-in-module, missing-function-docstring, invalid-name
 
+import pickle
+
+import numpy as np
 import pytest
 
+from runner import check_run_with_stats
+from chunks import unchunk
 from fpsemi_intf import (
     check_validation,
     check_converters,
@@ -22,7 +27,7 @@ from fpsemi_intf import (
     check_operators,
     check_running_and_state,
 )
-from libsemigroups_pybind11 import ReportGuard, KnuthBendix
+from libsemigroups_pybind11 import ReportGuard, KnuthBendix, wislo
 
 
 def test_validation_other():
@@ -327,3 +332,108 @@ def test_alphabet_bug():
     assert k.uint_to_char(127) == "\x80"
     assert k.string_to_word("\x80") == [127]
     assert k.word_to_string([127]) == "\x80"
+
+
+def test_pickle():
+    ReportGuard(False)
+    kb = KnuthBendix()
+    kb.set_alphabet("ab")
+    kb.add_rule("aa", "")
+    kb.add_rule("bbb", "")
+    kb.add_rule("ababab", "")
+
+    copy = pickle.loads(pickle.dumps(kb))
+    assert copy.alphabet() == "ab"
+    assert list(copy.rules()) == list(kb.rules())
+    assert not copy.finished()
+
+    kb.run()
+    copy = pickle.loads(pickle.dumps(kb))
+    assert not copy.started()
+    assert copy.confluent()
+    assert copy.size() == 12
+    assert copy.finished()
+    assert copy.active_rules() == kb.active_rules()
+    assert copy.normal_form("abababbb") == kb.normal_form("abababbb")
+
+    copy = pickle.loads(pickle.dumps(KnuthBendix()))
+    assert copy.alphabet() == ""
+
+    kb = KnuthBendix()
+    kb.set_alphabet("eaA")
+    kb.set_identity("e")
+    kb.set_inverses("eAa")
+    kb.add_rule("aaa", "e")
+    kb.overlap_policy(KnuthBendix.overlap.AB_BC).max_rules(1000)
+    kb.max_overlap(20).check_confluence_interval(10)
+    settings = {
+        "overlap_policy": KnuthBendix.overlap.AB_BC,
+        "max_rules": 1000,
+        "max_overlap": 20,
+        "check_confluence_interval": 10,
+    }
+    copy = pickle.loads(pickle.dumps(kb))
+    assert copy.identity() == "e"
+    assert copy.inverses() == "eAa"
+    assert list(copy.rules()) == list(kb.rules())
+    assert copy.__dict__["_settings"] == settings
+    copy = pickle.loads(pickle.dumps(copy))
+    assert copy.__dict__["_settings"] == settings
+    assert copy.size() == 3
+
+
+def test_batch_rewrite():
+    ReportGuard(False)
+    kb = KnuthBendix()
+    kb.set_alphabet("abc")
+    kb.add_rule("aa", "")
+    kb.add_rule("bc", "")
+    kb.add_rule("bbb", "")
+    kb.add_rule("ababababababab", "")
+    kb.add_rule("abacabacabacabac", "")
+
+    strings = ["abc" * i + "b" * (i % 5) for i in range(20)]
+    expected = [kb.normal_form(w) for w in strings]
+    for max_threads in (0, 1, 2, 4):
+        assert kb.normal_form_many(strings, max_threads) == expected
+        assert kb.rewrite_many(strings, max_threads) == expected
+    assert kb.normal_form_many([]) == []
+
+    words = list(wislo(3, [0], [0, 0, 0, 0, 0]))
+    expected = [kb.normal_form(w) for w in words]
+    assert kb.normal_form_many(words, 3) == expected
+    assert kb.rewrite_many(words) == expected
+
+    offsets = np.cumsum([0] + [len(w) for w in words])
+    letters = np.concatenate(words)
+    chunk = kb.normal_form_many(offsets, letters, max_threads=2)
+    assert unchunk([chunk]) == expected
+
+    with pytest.raises(RuntimeError):
+        kb.normal_form_many(["abd"])
+    with pytest.raises(RuntimeError):
+        kb.rewrite_many([[0, 3]], 2)
+    with pytest.raises(RuntimeError):
+        kb.rewrite_many([0, 2, 1], [0, 1])
+    with pytest.raises(RuntimeError):
+        kb.normal_form_many([0, 2], np.array([0.0, 1.5]))
+    with pytest.raises(RuntimeError):
+        kb.rewrite_many([0, 2], [0, -1])
+
+
+def test_run_with_stats():
+    def make():
+        kb = KnuthBendix()
+        kb.set_alphabet("abce")
+        kb.set_identity("e")
+        kb.add_rule("aa", "e")
+        kb.add_rule("bc", "e")
+        kb.add_rule("bbb", "e")
+        kb.add_rule("ababababababab", "e")
+        kb.add_rule("abacabacabacabacabacabacabacabac", "e")
+        return kb
+
+    check_run_with_stats(make, ("active_rules", "rules"))
+    kb = make()
+    kb.run()
+    assert kb.stats()["active_rules"] == kb.number_of_active_rules()
@@ -458,3 +458,43 @@ def test_case_030():
     assert S.size() == 21033
     with pytest.raises(RuntimeError):
         S.add_generator(gens[0])
+
+
+def test_green_structure():
+    ReportGuard(False)
+    k = Konieczny(
+        [
+            Transf([1, 0, 2, 3, 4]),
+            Transf([1, 2, 3, 4, 0]),
+            Transf([0, 0, 2, 3, 4]),
+        ]
+    )
+    d = k.green_structure()
+    n = k.number_of_D_classes()
+    assert n == 5
+    for key in (
+        "size",
+        "number_of_L_classes",
+        "number_of_R_classes",
+        "number_of_H_classes",
+        "size_H_class",
+        "number_of_idempotents",
+        "is_regular",
+    ):
+        assert len(d[key]) == n
+    assert sum(d["size"]) == k.size() == 3125
+    assert sum(d["number_of_L_classes"]) == k.number_of_L_classes()
+    assert sum(d["number_of_R_classes"]) == k.number_of_R_classes()
+    assert sum(d["number_of_H_classes"]) == k.number_of_H_classes()
+    assert sum(d["number_of_idempotents"]) == k.number_of_idempotents()
+    assert all(d["is_regular"])
+    assert list(d["size"]) == [
+        d["number_of_H_classes"][i] * d["size_H_class"][i] for i in range(n)
+    ]
+    for i, D in enumerate(k.D_classes()):
+        assert d["size"][i] == D.size()
+        assert d["size_H_class"][i] == D.size_H_class()
+
+    reps = [D.rep() for D in k.D_classes()]
+    assert list(k.D_class_indices(reps)) == list(range(n))
+    assert list(k.D_class_indices([])) == []
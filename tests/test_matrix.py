@@ -13,9 +13,12 @@ This module contains some tests for matrices.
 # pylint: disable=no-name-in-module, missing-function-docstring
 # pylint: disable=invalid-name, redefined-outer-name
 
+import pickle
+
+import numpy as np
 import pytest
 
-from _libsemigroups_pybind11 import (
+from _libsemigroups_pybind11 import (  # pylint: disable=unused-import
     BMat,
     IntMat,
     MaxPlusMat,
@@ -24,11 +27,15 @@ from _libsemigroups_pybind11 import (
     MaxPlusTruncMat,
     MinPlusTruncMat,
     NTPMat,
+    MaxPlusTruncSemiring,
+    MinPlusTruncSemiring,
+    NTPSemiring,
 )
 
 from libsemigroups_pybind11 import (  # pylint: disable=unused-import
     Matrix,
     MatrixKind,
+    matrix,
 )
 
 
@@ -168,3 +175,137 @@ def test_repr(matrix_types):
     for T in matrix_types:
         x = make_mat(T, [[0, 1], [1, 0]])
         assert eval(str(x)) == x  # pylint: disable=eval-used
+
+
+def products(T, *args):
+    try:
+        return T.products(*args)
+    except TypeError:
+        try:
+            return T.products(11, *args)
+        except TypeError:
+            return T.products(5, 7, *args)
+
+
+def test_products(matrix_types):
+    for T in matrix_types:
+        x = [[0, 1, 1], [1, 0, 1], [1, 1, 1]]
+        y = [[0, 0, 0], [0, 1, 0], [1, 1, 1]]
+        z = products(T, [x, y], [y, x])
+        assert z.shape == (2, 3, 3)
+        assert make_mat(T, z[0].tolist()) == make_mat(T, x) * make_mat(T, y)
+        assert make_mat(T, z[1].tolist()) == make_mat(T, y) * make_mat(T, x)
+
+        z = products(T, [x, y], y)
+        assert z.shape == (2, 3, 3)
+        assert make_mat(T, z[1].tolist()) == make_mat(T, y) * make_mat(T, y)
+
+        z = products(T, x, y)
+        assert z.shape == (3, 3)
+        assert make_mat(T, z.tolist()) == make_mat(T, x) * make_mat(T, y)
+
+        empty = np.zeros((0, 3, 3), dtype=int)
+        assert products(T, empty, y).shape == (0, 3, 3)
+        with pytest.raises(RuntimeError):
+            products(T, [x, y], [y, x, y])
+        with pytest.raises(RuntimeError):
+            products(T, [[0, 1]], [[0, 1]])
+        with pytest.raises(RuntimeError):
+            products(T, x, [[0, 1], [1, 0]])
+        with pytest.raises(RuntimeError):
+            products(T, x, [[0.5, 0, 0], [0, 1, 0], [1, 1, 1]])
+        with pytest.raises(RuntimeError):
+            products(T, x, out_of_range(T, (3, 3)))
+
+
+def make_many(T, *args):
+    try:
+        return T.make_many(*args)
+    except TypeError:
+        try:
+            return T.make_many(11, *args)
+        except TypeError:
+            return T.make_many(5, 7, *args)
+
+
+def out_of_range(T, shape):
+    "Returns an array of the given shape of entries out of range for T."
+    info = np.iinfo(make_mat(T, [[0]]).to_numpy().dtype)
+    if info.min < 0:
+        return np.full(shape, int(info.max) + 1, dtype=np.uint64)
+    return np.full(shape, -1, dtype=np.int64)
+
+
+def test_numpy(matrix_types):
+    for T in matrix_types:
+        rows = [[0, 1, 1], [1, 0, 1]]
+        x = make_mat(T, rows)
+        assert x.to_numpy().shape == (2, 3)
+        assert make_mat(T, x.to_numpy()) == x
+        assert make_mat(T, np.array(rows)) == x
+        assert make_mat(T, np.array(rows, dtype=np.int8)) == x
+        with pytest.raises(RuntimeError):
+            make_mat(T, np.array([0, 1, 1]))
+        with pytest.raises(RuntimeError):
+            make_mat(T, np.array(rows, dtype=float))
+        with pytest.raises(RuntimeError):
+            make_mat(T, out_of_range(T, (2, 3)))
+
+        y = make_mat(T, [[1, 1, 0], [0, 0, 1]])
+        xs = make_many(T, np.array([rows, [[1, 1, 0], [0, 0, 1]]]))
+        assert xs == [x, y]
+        assert make_many(T, np.zeros((0, 2, 3), dtype=int)) == []
+        with pytest.raises(RuntimeError):
+            make_many(T, np.array(rows))
+        with pytest.raises(RuntimeError):
+            make_many(T, np.array([rows], dtype=np.float32))
+        with pytest.raises(RuntimeError):
+            make_many(T, out_of_range(T, (1, 2, 3)))
+
+    with pytest.raises(RuntimeError):
+        BMat.make_many(np.array([[[0, 2], [1, 0]]]))
+
+
+def test_semiring():
+    for kind, args in (
+        (MatrixKind.MaxPlusTrunc, (11,)),
+        (MatrixKind.MinPlusTrunc, (11,)),
+        (MatrixKind.NTP, (5, 7)),
+    ):
+        sr = matrix.semiring(kind, *args)
+        assert sr == matrix.semiring(kind, *args)
+        assert sr != matrix.semiring(kind, *(a + 1 for a in args))
+        assert hash(sr) == hash(matrix.semiring(kind, *args))
+        assert sr.threshold() == args[0]
+        assert eval(repr(sr)) == sr  # pylint: disable=eval-used
+
+        rows = [[0, 1], [1, 0]]
+        x = Matrix(kind, sr, rows)
+        assert x == Matrix(kind, *args, rows)
+        assert x.semiring() == sr
+        assert Matrix(kind, sr, np.array(rows)) == x
+        assert Matrix(kind, sr, 2, 2).semiring() == sr
+        assert matrix.make(kind, sr, rows) == x
+        assert matrix.make_identity(kind, sr, 2) == matrix.make_identity(
+            kind, *args, 2
+        )
+        assert matrix.make_many(kind, sr, np.array([rows])) == [x]
+        z = matrix.products(kind, sr, rows, rows)
+        assert z.tolist() == (x * x).to_numpy().tolist()
+        with pytest.raises(TypeError):
+            Matrix(kind, None, rows)
+
+    assert matrix.semiring(MatrixKind.NTP, 5, 7).period() == 7
+    with pytest.raises(TypeError):
+        matrix.semiring(MatrixKind.Integer, 11)
+
+
+def test_pickle(matrix_types):
+    for T in matrix_types:
+        x = make_mat(T, [[0, 1], [1, 0]])
+        y = pickle.loads(pickle.dumps(x))
+        assert type(y) is T
+        assert y == x
+        assert y is not x
+        if T not in (BMat, IntMat, MaxPlusMat, MinPlusMat, ProjMaxPlusMat):
+            assert y.semiring() == x.semiring()
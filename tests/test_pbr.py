@@ -12,6 +12,8 @@ This module contains some tests for PBRs.
 
 # pylint: disable= missing-function-docstring, invalid-name
 
+import pickle
+
 import pytest
 
 from element import check_products
@@ -68,3 +70,14 @@ def test_rank_degree():
     assert x.degree() == 3
     assert x.identity().degree() == 3
     assert PBR.make([[0, 1, 2]] * 16).degree() == 8
+
+
+def test_pickle():
+    for x in (
+        PBR.make([[0, 1, 2]] * 6),
+        PBR.make([[], [0, 3], [1], [2]]),
+        PBR.make([[0, 1, 2]] * 6).identity(),
+    ):
+        y = pickle.loads(pickle.dumps(x))
+        assert y == x
+        assert y is not x
@@ -1058,3 +1058,107 @@ def test_045():
     presentation.reverse(p)
     assert presentation.reduce_to_2_generators(p)
     assert p.rules == ["aba", "baabaa"]
+
+
+def test_rules_view():
+    p = Presentation([0, 1])
+    presentation.add_rule(p, [0, 0, 0], [1])
+    presentation.add_rule(p, [0, 1], [1, 0])
+    v = p.rules_view()
+    assert len(v) == 4
+    assert list(v) == p.rules
+    assert v[0] == [0, 0, 0]
+    assert v[-1] == [1, 0]
+    assert v.number_of_rules() == 2
+    assert v.rule(1) == ([0, 1], [1, 0])
+    assert v.rule(-2) == ([0, 0, 0], [1])
+    with pytest.raises(IndexError):
+        v[4]  # pylint: disable=pointless-statement
+    with pytest.raises(IndexError):
+        v.rule(2)
+
+    presentation.add_rule(p, [1, 1], [1])
+    assert len(v) == 6
+    assert v[4] == [1, 1]
+
+    q = Presentation("ab")
+    presentation.add_rule(q, "aaa", "b")
+    assert list(q.rules_view()) == ["aaa", "b"]
+
+
+def test_write_and_read_presentation(tmp_path):
+    p = Presentation([0, 1, 200, 100000])
+    p.contains_empty_word(True)
+    presentation.add_rule(p, [0, 200, 100000], [])
+    presentation.add_rule(p, [1] * 1000, [200, 1])
+    filename = str(tmp_path / "words.pres")
+    presentation.write_presentation(p, filename)
+    q = presentation.read_presentation(filename)
+    assert isinstance(q, type(p))
+    assert q.alphabet() == p.alphabet()
+    assert q.contains_empty_word()
+    assert q.rules == p.rules
+
+    p = Presentation("abc")
+    presentation.add_rule(p, "abcabc", "a")
+    presentation.add_rule(p, "bb", "c")
+    filename = str(tmp_path / "strings.pres")
+    presentation.write_presentation(p, filename)
+    q = presentation.read_presentation(filename)
+    assert isinstance(q, type(p))
+    assert q.alphabet() == "abc"
+    assert not q.contains_empty_word()
+    assert q.rules == p.rules
+
+    with open(filename, "rb") as f:
+        data = f.read()
+    with open(filename, "wb") as f:
+        f.write(data[:-2])
+    with pytest.raises(RuntimeError):
+        presentation.read_presentation(filename)
+    with open(filename, "wb") as f:
+        f.write(b"not a presentation")
+    with pytest.raises(RuntimeError):
+        presentation.read_presentation(filename)
+    with pytest.raises(RuntimeError):
+        presentation.read_presentation(str(tmp_path / "missing.pres"))
+
+
+def test_simplify():
+    passes = [
+        "remove_trivial_rules",
+        "remove_duplicate_rules",
+        "reduce_complements",
+        "sort_each_rule",
+        "sort_rules",
+    ]
+    for W in (to_word, to_string):
+        p = Presentation(W([0, 1, 2]))
+        presentation.add_rule(p, W([0, 0, 0]), W([0]))
+        presentation.add_rule(p, W([0, 0, 0]), W([0]))
+        presentation.add_rule(p, W([1, 2]), W([1, 2]))
+        presentation.add_rule(p, W([2, 2, 2, 2]), W([2, 2]))
+        presentation.add_rule(p, W([2, 2]), W([2]))
+        presentation.add_rule(p, W([1, 0, 1, 0]), W([0, 1]))
+
+        q = Presentation(p)
+        for name in passes:
+            getattr(presentation, name)(q)
+        presentation.simplify(p, passes)
+        assert p.rules == q.rules
+
+        with pytest.raises(RuntimeError):
+            presentation.simplify(p, ["sort_rules", "not_a_pass"])
+        assert p.rules == q.rules
+
+        repeated = ["greedy_reduce_length", "remove_duplicate_rules"]
+        q = Presentation(p)
+        while True:
+            before = presentation.length(q) + len(q.alphabet())
+            for name in repeated:
+                getattr(presentation, name)(q)
+            if presentation.length(q) + len(q.alphabet()) >= before:
+                break
+        presentation.simplify(p, repeated, True)
+        assert p.alphabet() == q.alphabet()
+        assert p.rules == q.rules
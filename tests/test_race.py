@@ -0,0 +1,169 @@
+# -*- coding: utf-8 -*-
+
+# Copyright (c) 2023, J. D. Mitchell
+#
+# Distributed under the terms of the GPL license version 3.
+#
+# The full license is in the file LICENSE, distributed with this software.
+
+# pylint: disable=no-name-in-module, missing-function-docstring, invalid-name
+
+"""
+This module contains some tests for Race.
+"""
+
+import os
+import signal
+import sys
+from threading import Timer
+
+import pytest
+
+from libsemigroups_pybind11 import (
+    CancellationToken,
+    FroidurePin,
+    KnuthBendix,
+    Race,
+    ReportGuard,
+    ToddCoxeter,
+    Transf,
+    congruence_kind,
+)
+
+
+def make_todd_coxeter(strategy):
+    tc = ToddCoxeter(congruence_kind.twosided)
+    tc.strategy(strategy)
+    tc.set_number_of_generators(2)
+    tc.add_pair([0, 0, 0], [0])
+    tc.add_pair([1, 1, 1, 1], [1])
+    tc.add_pair([0, 1, 0, 1], [0, 0])
+    return tc
+
+
+def make_knuth_bendix():
+    kb = KnuthBendix()
+    kb.overlap_policy(KnuthBendix.overlap.MAX_AB_BC)
+    kb.set_alphabet("ab")
+    kb.add_rule("aaa", "a")
+    kb.add_rule("bbbb", "b")
+    kb.add_rule("abab", "aa")
+    return kb
+
+
+def make_infinite():
+    tc = ToddCoxeter(congruence_kind.twosided)
+    tc.set_number_of_generators(1)
+    return tc
+
+
+def make_raising():
+    # Running this raises, since it has no relations
+    tc = ToddCoxeter(congruence_kind.twosided)
+    tc.set_number_of_generators(5)
+    return tc
+
+
+def make_race():
+    race = Race()
+    race.add_runner(make_todd_coxeter(ToddCoxeter.strategy_options.felsch))
+    race.add_runner(make_todd_coxeter(ToddCoxeter.strategy_options.hlt))
+    race.add_runner(make_knuth_bendix())
+    return race
+
+
+def test_race():
+    ReportGuard(False)
+    race = make_race()
+    assert race.number_of_runners() == 3
+    assert len(race) == 3
+    assert not race.finished()
+    assert race.winner() is None
+    assert race.winner_index() is None
+
+    race.max_threads(3)
+    assert race.max_threads() == 3
+    winner = race.run()
+    assert race.finished()
+    assert winner is race.winner()
+    assert winner is race.runner(race.winner_index())
+    assert winner.finished()
+    for i in range(len(race)):
+        if i != race.winner_index():
+            assert race.runner(i).finished() or race.runner(i).dead()
+    # Running a race that has been won returns the same winner
+    assert race.run() is winner
+
+    with pytest.raises(RuntimeError):
+        race.add_runner(make_knuth_bendix())
+    with pytest.raises(IndexError):
+        race.runner(3)
+
+
+def test_race_froidure_pin():
+    ReportGuard(False)
+    race = Race()
+    S = FroidurePin(Transf([1, 0, 2, 3, 4]), Transf([1, 2, 3, 4, 0]))
+    race.add_runner(S)
+    assert race.run() is S
+    assert S.size() == 120
+
+
+def test_race_stopped():
+    ReportGuard(False)
+    token = CancellationToken()
+    token.cancel()
+    race = make_race()
+    assert race.run_until(token) is None
+    assert not race.finished()
+    token.reset()
+    assert race.run_until(token) is not None
+    assert race.finished()
+
+
+def test_race_errors():
+    race = Race()
+    with pytest.raises(RuntimeError):
+        race.run()
+    with pytest.raises(RuntimeError):
+        race.add_runner(1)
+    tc = make_todd_coxeter(ToddCoxeter.strategy_options.hlt)
+    race.add_runner(tc)
+    with pytest.raises(RuntimeError):
+        race.add_runner(tc)
+
+
+def test_race_runner_raises():
+    ReportGuard(False)
+    for first in (True, False):
+        race = Race()
+        infinite = make_infinite()
+        if first:
+            race.add_runner(make_raising())
+            race.add_runner(infinite)
+        else:
+            race.add_runner(infinite)
+            race.add_runner(make_raising())
+        race.max_threads(2)
+        with pytest.raises(RuntimeError):
+            race.run()
+        assert not race.finished()
+        assert infinite.dead()
+
+
+@pytest.mark.skipif(
+    sys.platform == "win32", reason="os.kill cannot send SIGINT on Windows"
+)
+def test_race_keyboard_interrupt():
+    ReportGuard(False)
+    race = Race()
+    race.add_runner(make_infinite())
+    race.add_runner(make_infinite())
+    race.max_threads(2)
+    timer = Timer(0.01, os.kill, (os.getpid(), signal.SIGINT))
+    timer.start()
+    with pytest.raises(KeyboardInterrupt):
+        race.run()
+    timer.join()
+    assert not race.finished()
+    assert race.runner(1).dead()
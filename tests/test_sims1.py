@@ -17,7 +17,9 @@ import pytest
 
 from libsemigroups_pybind11 import (
     FroidurePin,
+    MinimalRepOrc,
     Presentation,
+    RepOrc,
     ReportGuard,
     Sims1,
     Transf,
@@ -288,3 +290,90 @@ def test_070():
     S = Sims1(congruence_kind.right)
     S.short_rules(p)
     assert S.number_of_congruences(4) == 5477
+
+
+def check_batches(S):
+    batches = list(S.batches(4, 100))
+    assert all(0 < len(batch) <= 100 for batch in batches)
+    assert sum(len(batch) for batch in batches) == 5477
+    assert all(x.number_of_nodes() == 4 for batch in batches for x in batch)
+
+    it = S.batches(4, batch_size=10, max_pending=1)
+    assert len(next(it)) == 10
+    it.stop()
+    with pytest.raises(StopIteration):
+        next(it)
+
+    total = []
+
+    def count(batch):
+        total.append(len(batch))
+        return sum(total) >= 1000
+
+    S.for_each(4, count, batch_size=100)
+    assert 1000 <= sum(total) < 5477
+
+    x = S.find_if(4, lambda d: d.number_of_edges() == 8)
+    assert x.number_of_edges() == 8
+    assert S.find_if(4, lambda d: False).number_of_nodes() == 0
+
+    def error(_batch):
+        raise ValueError
+
+    with pytest.raises(ValueError):
+        S.for_each(4, error)
+
+
+def test_batches():
+    ReportGuard(False)
+    p = Presentation([0, 1])
+    p.contains_empty_word(True)
+    S = Sims1(congruence_kind.right)
+    S.short_rules(p)
+
+    check_batches(S.number_of_threads(1))
+    check_batches(S.number_of_threads(4))
+
+
+def size_of_action(d):
+    gens = [
+        Transf([d.neighbor(i, a) for i in range(d.number_of_nodes())])
+        for a in range(d.out_degree())
+    ]
+    return FroidurePin(gens).size()
+
+
+def test_rep_orc():
+    ReportGuard(False)
+    S = FroidurePin(Transf([1, 2, 0]), Transf([1, 0, 2]), Transf([0, 1, 0]))
+    p = presentation.make(S)
+
+    d = (
+        RepOrc()
+        .short_rules(p)
+        .number_of_threads(2)
+        .min_nodes(1)
+        .max_nodes(27)
+        .target_size(27)
+        .digraph()
+    )
+    assert 0 < d.number_of_nodes() <= 27
+    assert size_of_action(d) == 27
+
+    d = RepOrc().short_rules(p).max_nodes(1).target_size(27).digraph()
+    assert d.number_of_nodes() == 0
+
+
+def test_minimal_rep_orc():
+    ReportGuard(False)
+    S = FroidurePin(Transf([1, 2, 0]), Transf([1, 0, 2]), Transf([0, 1, 0]))
+    p = presentation.make(S)
+
+    orc = MinimalRepOrc().short_rules(p).number_of_threads(2).target_size(27)
+    d = orc.digraph()
+    assert d.number_of_nodes() == 3
+    assert size_of_action(d) == 27
+    assert (
+        orc.number_of_threads(1).digraph().number_of_nodes()
+        == d.number_of_nodes()
+    )
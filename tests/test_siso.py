@@ -12,7 +12,14 @@
 This module contains some tests for silo/siso.
 """
 
-from libsemigroups_pybind11 import silo, sislo, number_of_words
+from chunks import unchunk
+from libsemigroups_pybind11 import (
+    number_of_words,
+    silo,
+    silo_chunks,
+    sislo,
+    sislo_chunks,
+)
 
 
 def test_001():
@@ -285,3 +292,15 @@ def test_008():
     w = list(sislo("abc", "", "aaaaaaaaaaaaa"))
     assert len(w) == 797161
     assert len(w) == number_of_words(3, 0, 13)
+
+
+def test_chunks():
+    w = list(silo("abc", 6, "ab", "cca"))
+    assert unchunk(silo_chunks("abc", 6, "ab", "cca", 7)) == w
+    assert unchunk(silo_chunks("abc", 6, "ab", "cca")) == w
+    w = list(sislo("abc", "ab", "ccab"))
+    assert unchunk(sislo_chunks("abc", "ab", "ccab", 7)) == w
+    assert unchunk(sislo_chunks("abc", "ab", "ccab")) == w
+    offsets, letters = next(silo_chunks("ba", 3, "b", "aaa"))
+    assert offsets.tolist() == [0, 1, 3, 5, 6, 8, 10]
+    assert letters == b"bbbbaaabaa"
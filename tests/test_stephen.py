@@ -14,6 +14,9 @@ This module contains some tests for the Stephen class.
 # pylint: disable=missing-function-docstring, invalid-name
 import itertools
 
+import pytest
+
+from chunks import unchunk
 from libsemigroups_pybind11 import (
     POSITIVE_INFINITY,
     UNDEFINED,
@@ -105,3 +108,41 @@ def test_000():
     assert s.word_graph() == action_digraph_helper.make(
         3, [[1, UNDEFINED], [2, UNDEFINED], [1, UNDEFINED]]
     )
+
+
+def test_batch():
+    p = Presentation([0, 1])
+    presentation.add_rule_and_check(p, [0, 0, 0], [0])
+    presentation.add_rule_and_check(p, [1, 1, 1], [1])
+    presentation.add_rule_and_check(p, [0, 1, 0, 1], [0, 0])
+    s = Stephen(p)
+    s.set_word([1, 1, 0, 1])
+
+    words = [[1, 1, 0, 0, 1, 0], [], [0] * 10, [1, 1, 1], [1, 1, 0, 1]]
+    expected = [stephen.accepts(s, w) for w in words]
+    for max_threads in (1, 2, 0):
+        assert stephen.accepts_many(s, words, max_threads).tolist() == expected
+    assert stephen.accepts_many(s, []).tolist() == []
+
+    offsets = [0]
+    letters = []
+    for w in words:
+        letters.extend(w)
+        offsets.append(len(letters))
+    assert stephen.accepts_many(s, offsets, letters).tolist() == expected
+
+    expected = [stephen.is_left_factor(s, w) for w in words]
+    assert stephen.is_left_factor_many(s, words, 2).tolist() == expected
+
+    with pytest.raises(RuntimeError):
+        stephen.accepts_many(s, [[2]])
+
+    chunks = stephen.words_accepted_chunks(s, chunk_size=10)
+    offsets, letters = next(chunks)
+    assert [
+        letters[offsets[i] : offsets[i + 1]].tolist() for i in range(10)
+    ] == list(itertools.islice(stephen.words_accepted(s), 10))
+
+    chunks = list(stephen.left_factors_chunks(s, 0, 4, chunk_size=3))
+    assert all(len(offsets) <= 4 for offsets, _ in chunks)
+    assert unchunk(chunks) == list(stephen.left_factors(s, 0, 4))
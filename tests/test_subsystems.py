@@ -0,0 +1,151 @@
+# -*- coding: utf-8 -*-
+
+# Copyright (c) 2023, J. D. Mitchell
+#
+# Distributed under the terms of the GPL license version 3.
+#
+# The full license is in the file LICENSE, distributed with this software.
+
+"""
+This file contains tests for the lazily bound subsystems of
+_libsemigroups_pybind11.
+"""
+
+# pylint: disable=no-name-in-module, missing-function-docstring, invalid-name
+# pylint: disable=protected-access
+
+import os
+import subprocess
+import sys
+
+import pytest
+
+import _libsemigroups_pybind11
+import libsemigroups_pybind11
+from libsemigroups_pybind11.tools import ELEMENT_TYPES, element_types
+
+
+def loaded_subsystems(code, eager=False):
+    "Run code in a new process, and return the subsystems bound after it."
+    env = dict(os.environ)
+    env.pop("LIBSEMIGROUPS_PYBIND11_EAGER", None)
+    if eager:
+        env["LIBSEMIGROUPS_PYBIND11_EAGER"] = "1"
+    code += (
+        "\nimport _libsemigroups_pybind11"
+        "\nprint(' '.join(_libsemigroups_pybind11._loaded_subsystems()))"
+    )
+    return subprocess.run(
+        [sys.executable, "-c", code],
+        check=True,
+        capture_output=True,
+        text=True,
+        env=env,
+    ).stdout.split()
+
+
+def test_lazy():
+    assert not loaded_subsystems("import libsemigroups_pybind11")
+    assert not loaded_subsystems(
+        "from libsemigroups_pybind11 import POSITIVE_INFINITY, ReportGuard"
+    )
+    assert loaded_subsystems(
+        "from libsemigroups_pybind11 import ActionDigraph"
+    ) == ["digraphs"]
+    assert loaded_subsystems("from libsemigroups_pybind11 import Transf") == [
+        "digraphs",
+        "elements",
+    ]
+    assert loaded_subsystems(
+        "from libsemigroups_pybind11 import FroidurePin"
+    ) == ["digraphs", "elements", "froidure_pin"]
+    assert loaded_subsystems(
+        "from libsemigroups_pybind11 import ToddCoxeter"
+    ) == ["digraphs", "elements", "froidure_pin", "congruences"]
+    assert loaded_subsystems(
+        "import _libsemigroups_pybind11 as m\nm._load_subsystem('elements')"
+    ) == ["digraphs", "elements"]
+    assert not loaded_subsystems(
+        "import _libsemigroups_pybind11 as m\nassert not hasattr(m, '__path__')"
+    )
+    assert loaded_subsystems(
+        "import _libsemigroups_pybind11 as m\nassert not hasattr(m, 'banana')"
+    ) == ["digraphs", "elements", "froidure_pin", "congruences"]
+    assert not loaded_subsystems(
+        "import libsemigroups_pybind11 as m\nassert not hasattr(m, 'Tranfs')"
+    )
+    assert loaded_subsystems(
+        "import _libsemigroups_pybind11 as m\nm.FroidurePinTransf1"
+    ) == ["digraphs", "elements", "froidure_pin"]
+    assert loaded_subsystems(
+        "from libsemigroups_pybind11 import Presentation"
+    ) == ["digraphs", "elements", "froidure_pin", "congruences"]
+
+
+def test_every_name():
+    names = subprocess.run(
+        [
+            sys.executable,
+            "-c",
+            "import _libsemigroups_pybind11 as m\nprint(' '.join(dir(m)))",
+        ],
+        check=True,
+        capture_output=True,
+        text=True,
+        env=dict(os.environ, LIBSEMIGROUPS_PYBIND11_EAGER="1"),
+    ).stdout.split()
+    assert "PresentationWordsRulesView" in names
+    loaded_subsystems(
+        "import _libsemigroups_pybind11 as m\n"
+        f"for name in {names!r}:\n"
+        "    getattr(m, name)"
+    )
+    loaded_subsystems(
+        "import libsemigroups_pybind11 as m\n"
+        "for name in set(m.__all__) | set(dir(m)):\n"
+        "    getattr(m, name)"
+    )
+    assert loaded_subsystems(
+        "from _libsemigroups_pybind11 import PresentationWordsRulesView"
+    ) == ["digraphs", "elements", "froidure_pin", "congruences"]
+
+
+def test_eager():
+    assert loaded_subsystems("import libsemigroups_pybind11", eager=True) == [
+        "digraphs",
+        "elements",
+        "froidure_pin",
+        "congruences",
+    ]
+
+
+def test_getattr():
+    _libsemigroups_pybind11._load_subsystem("congruences")
+    _libsemigroups_pybind11._load_subsystem("congruences")
+    assert _libsemigroups_pybind11._loaded_subsystems() == [
+        "digraphs",
+        "elements",
+        "froidure_pin",
+        "congruences",
+    ]
+    with pytest.raises(RuntimeError):
+        _libsemigroups_pybind11._load_subsystem("banana")
+    with pytest.raises(AttributeError):
+        _libsemigroups_pybind11.banana  # pylint: disable=pointless-statement
+    with pytest.raises(AttributeError):
+        libsemigroups_pybind11.banana  # pylint: disable=pointless-statement
+    assert "ToddCoxeter" in dir(libsemigroups_pybind11)
+    assert "FroidurePin" in libsemigroups_pybind11.__all__
+    assert libsemigroups_pybind11.Word is _libsemigroups_pybind11.Word
+
+
+def test_element_types():
+    enabled = _libsemigroups_pybind11._enabled_elements
+    assert set(enabled) <= set(ELEMENT_TYPES)
+    types = element_types()
+    assert list(types) == [x for x in ELEMENT_TYPES if x in enabled]
+    for name, type_ in types.items():
+        assert type_.__name__ == name
+    assert list(element_types("BMat8", "banana")) == [
+        x for x in ("BMat8",) if x in enabled
+    ]
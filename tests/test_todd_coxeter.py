@@ -12,8 +12,13 @@ This module contains some tests for the ToddCoxeter class.
 """
 
 from datetime import timedelta
+import pickle
+from threading import Thread
 
+import numpy as np
 import pytest
+from cong_intf import make_10752
+from runner import check_run_with_stats
 
 from libsemigroups_pybind11 import (
     FroidurePin,
@@ -23,6 +28,7 @@ from libsemigroups_pybind11 import (
     Transf,
     congruence_kind,
     tril,
+    wislo,
 )
 
 strategy = ToddCoxeter.strategy_options
@@ -365,3 +371,117 @@ def test_to_gap_string():
     tc.add_pair([0, 1], [1, 0])
     with pytest.raises(RuntimeError):
         tc.to_gap_string()
+
+
+def test_run_in_threads():
+    ReportGuard(False)
+
+    tcs = [make_10752(strategy.hlt), make_10752(strategy.felsch)]
+    threads = [Thread(target=tc.run) for tc in tcs]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    for tc in tcs:
+        assert tc.finished()
+        assert tc.number_of_classes() == 10752
+
+
+def test_run_with_stats():
+    check_run_with_stats(
+        make_10752, ("active_cosets", "defined_cosets", "killed_cosets")
+    )
+    tc = make_10752()
+    tc.run()
+    stats = tc.stats()
+    assert stats["active_cosets"] >= tc.number_of_classes()
+    assert stats["defined_cosets"] >= stats["active_cosets"]
+
+
+def test_table_and_prefill():
+    ReportGuard(False)
+    tc = ToddCoxeter(congruence_kind.twosided)
+    tc.set_number_of_generators(2)
+    tc.add_pair([0, 0, 0], [0])
+    tc.add_pair([1, 1, 1, 1], [1])
+    tc.add_pair([0, 1, 0, 1], [0, 0])
+    table = tc.table()
+    n = tc.number_of_classes()
+    assert table.shape == (n + 1, 2)
+    assert tc.is_standardized()
+    assert all(0 < x <= n for x in table.flat)
+    for i in range(n):
+        w = tc.class_index_to_word(i)
+        for a in range(2):
+            assert table[i + 1][a] == tc.word_to_class_index(w + [a]) + 1
+
+    # Restarting from the table gives the same congruence
+    warm = ToddCoxeter(congruence_kind.twosided)
+    warm.set_number_of_generators(2)
+    warm.prefill(table)
+    assert warm.number_of_classes() == n
+
+    # ... and adding extra pairs gives the same result as from scratch
+    warm = ToddCoxeter(congruence_kind.twosided)
+    warm.set_number_of_generators(2)
+    warm.prefill(table)
+    warm.add_pair([0], [1])
+    cold = ToddCoxeter(congruence_kind.twosided)
+    cold.set_number_of_generators(2)
+    for u, v in tc.generating_pairs():
+        cold.add_pair(u, v)
+    cold.add_pair([0], [1])
+    assert warm.number_of_classes() == cold.number_of_classes()
+
+    with pytest.raises(RuntimeError):
+        warm.prefill(table)
+    bad = ToddCoxeter(congruence_kind.twosided)
+    bad.set_number_of_generators(2)
+    with pytest.raises(RuntimeError):
+        bad.prefill([0, 1])
+
+
+def test_pickle():
+    ReportGuard(False)
+    for kind in (congruence_kind.left, congruence_kind.twosided):
+        tc = ToddCoxeter(kind)
+        tc.set_number_of_generators(2)
+        tc.add_pair([0, 0, 0], [0])
+        tc.add_pair([1, 1, 1, 1], [1])
+        tc.add_pair([0, 1, 0, 1], [0, 0])
+        with pytest.raises(RuntimeError):
+            pickle.dumps(tc)
+        tc.run()
+        copy = pickle.loads(pickle.dumps(tc))
+        assert copy.kind() == kind
+        assert copy.number_of_generators() == 2
+        assert copy.number_of_classes() == tc.number_of_classes()
+        words = list(wislo(2, [], [0, 0, 0, 0, 0]))
+        for u in words:
+            for v in words:
+                assert copy.contains(u, v) == tc.contains(u, v)
+
+
+def test_batch_word_to_class_index():
+    ReportGuard(False)
+    tc = make_10752()
+    words = list(wislo(4, [], [0, 1, 2, 3, 0, 1]))
+    expected = [tc.word_to_class_index(w) for w in words]
+    for max_threads in (1, 2, 0):
+        result = tc.word_to_class_indices(words, max_threads)
+        assert isinstance(result, np.ndarray)
+        assert list(result) == expected
+
+    offsets = np.cumsum([0] + [len(w) for w in words])
+    letters = np.array([a for w in words for a in w])
+    assert list(tc.word_to_class_indices(offsets, letters, 2)) == expected
+
+    us, vs = words[:-1], words[1:]
+    expected = [tc.contains(u, v) for u, v in zip(us, vs)]
+    assert list(tc.contains_many(us, vs, 2)) == expected
+    assert list(tc.contains_many([[1, 1]], [[0]])) == [True]
+
+    with pytest.raises(RuntimeError):
+        tc.word_to_class_indices([[0], [4]], 2)
+    with pytest.raises(RuntimeError):
+        tc.contains_many(us, vs[1:])
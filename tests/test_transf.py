@@ -13,6 +13,8 @@ This module contains some tests for transformations, partial perms, and
 permutations.
 """
 
+import pickle
+
 import pytest
 
 from _libsemigroups_pybind11 import (
@@ -304,3 +306,59 @@ def test_perm2():
 
 def test_perm4():
     check_perm(Perm4)
+
+
+def test_pickle():
+    for T in (Transf16, Transf1, Transf2, Transf4):
+        add = list(range(3, 16)) if T is Transf16 else []
+        x = T.make([1, 0, 0] + add)
+        y = pickle.loads(pickle.dumps(x))
+        assert type(y) is T
+        assert y == x
+
+    for T in (PPerm16, PPerm1, PPerm2, PPerm4):
+        x = T.make([0, 2], [1, 0], 16 if T is PPerm16 else 3)
+        y = pickle.loads(pickle.dumps(x))
+        assert type(y) is T
+        assert y == x
+
+    for T in (Perm16, Perm1, Perm2, Perm4):
+        add = list(range(3, 16)) if T is Perm16 else []
+        x = T.make([1, 2, 0] + add)
+        y = pickle.loads(pickle.dumps(x))
+        assert type(y) is T
+        assert y == x
+
+
+def test_products():
+    for T in (Transf16, Transf1, Transf2, Transf4, Perm16, Perm1, Perm2, Perm4):
+        x = [1, 2, 0] + list(range(3, 16))
+        y = [1, 0, 2] + list(range(3, 16))
+        if T in (Transf16, Transf1, Transf2, Transf4):
+            y[3] = 0
+        z = T.products([x, y], [y, x])
+        assert z.shape == (2, 16)
+        assert z[0].tolist() == list((T.make(x) * T.make(y)).images())
+        assert z[1].tolist() == list((T.make(y) * T.make(x)).images())
+
+        z = T.products(x, [x, y, x])
+        assert z.shape == (3, 16)
+        assert z[1].tolist() == list((T.make(x) * T.make(y)).images())
+
+        assert T.products(x, y).tolist() == list(
+            (T.make(x) * T.make(y)).images()
+        )
+
+        with pytest.raises(RuntimeError):
+            T.products([x, y], [x, y, x])
+        with pytest.raises(RuntimeError):
+            T.products(x, [0, 1])
+        with pytest.raises(RuntimeError):
+            T.products(x, [16] + y[1:])
+
+    for T in (PPerm16, PPerm1, PPerm2, PPerm4):
+        x = T.make([0, 2], [1, 0], 16)
+        y = T.make([0, 1], [0, 2], 16)
+        z = T.products([list(x.images())], list(y.images()))
+        assert z.shape == (1, 16)
+        assert z[0].tolist() == list((x * y).images())
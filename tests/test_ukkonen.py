@@ -14,6 +14,7 @@ ukkonen.
 # pylint: disable=missing-class-docstring, invalid-name
 
 
+import numpy as np
 import pytest
 
 from libsemigroups_pybind11 import (
@@ -225,6 +226,14 @@ def test_003_b():
     assert ukkonen.number_of_pieces(t, [1, 2, 4]) == POSITIVE_INFINITY
     assert ukkonen.pieces(t, [1, 2, 4]) == []
 
+    for many in (
+        ukkonen.number_of_pieces_many,
+        ukkonen.number_of_pieces_many_no_checks,
+    ):
+        result = many(t, [[0, 1, 2], [1, 2, 4]])
+        assert result.tolist() == [POSITIVE_INFINITY] * 2
+        assert (result == np.iinfo(result.dtype).max).all()
+
 
 def test_004():
     t = Ukkonen()
@@ -288,3 +297,62 @@ def test_004():
         [8, 4, 5],
         [6, 7],
     ]
+
+
+def test_batch():
+    t = Ukkonen()
+    ukkonen.add_words(t, [[0, 1, 2], [1, 2, 4], [0, 0, 4, 0, 0, 0]])
+    words = [[], [0], [0, 1], [1, 2], [1, 2, 4], [0, 0, 4], [4, 4], [2, 4]]
+    offsets = np.cumsum([0] + [len(w) for w in words])
+    letters = [a for w in words for a in w]
+
+    for many, one in (
+        (ukkonen.is_subword_many, ukkonen.is_subword),
+        (ukkonen.is_subword_many_no_checks, ukkonen.is_subword_no_checks),
+        (ukkonen.is_suffix_many, ukkonen.is_suffix),
+        (ukkonen.is_suffix_many_no_checks, ukkonen.is_suffix_no_checks),
+        (ukkonen.is_piece_many, ukkonen.is_piece),
+        (ukkonen.is_piece_many_no_checks, ukkonen.is_piece_no_checks),
+        (ukkonen.number_of_pieces_many, ukkonen.number_of_pieces),
+        (
+            ukkonen.number_of_pieces_many_no_checks,
+            ukkonen.number_of_pieces_no_checks,
+        ),
+    ):
+        expected = [one(t, w) for w in words]
+        assert many(t, words).tolist() == expected
+        assert many(t, offsets, letters).tolist() == expected
+
+    for many, one in (
+        (ukkonen.maximal_piece_prefix_lengths, ukkonen.maximal_piece_prefix),
+        (ukkonen.maximal_piece_suffix_lengths, ukkonen.maximal_piece_suffix),
+    ):
+        expected = [len(one(t, w)) for w in words]
+        assert many(t, words).tolist() == expected
+        assert many(t, offsets, letters).tolist() == expected
+
+    assert ukkonen.number_of_pieces_many(t, [[0, 1, 2]])[0] == (
+        ukkonen.number_of_pieces(t, [0, 1, 2])
+    )
+    assert len(ukkonen.is_subword_many(t, [])) == 0
+
+    with pytest.raises(RuntimeError):
+        ukkonen.is_subword_many(t, [[0], [UNDEFINED]])
+    with pytest.raises(RuntimeError):
+        ukkonen.is_piece_many(t, [2, 1], letters)
+    with pytest.raises(RuntimeError):
+        ukkonen.is_piece_many(t, [0, 1], np.array([0.5]))
+    with pytest.raises(RuntimeError):
+        ukkonen.number_of_pieces_many(t, [0, 1], [-1])
+
+
+def test_batch_strings():
+    t = Ukkonen()
+    ukkonen.add_words(t, [[97, 98, 99], [98, 99, 100]])
+    words = ["", "a", "bc", "bcd", "cd", "dd"]
+    assert ukkonen.is_subword_many(t, words).tolist() == [
+        ukkonen.is_subword(t, w) for w in words
+    ]
+    assert ukkonen.maximal_piece_prefix_lengths(t, words).tolist() == [
+        len(ukkonen.maximal_piece_prefix(t, w)) for w in words
+    ]
@@ -11,7 +11,15 @@
 This module contains some functions used in tests for wilo.
 """
 
-from libsemigroups_pybind11 import wilo, number_of_words
+import pytest
+
+from chunks import unchunk
+from libsemigroups_pybind11 import (
+    number_of_words,
+    wilo,
+    wilo_chunks,
+    wilo_split,
+)
 
 
 def test_001():
@@ -170,3 +178,40 @@ def test_008():
     assert u == [[0, 1], [1], [1, 0], [1, 1]]
     w = list(wilo(2, 1, first, last))
     assert not w
+
+
+def test_chunks():
+    w = [list(x) for x in wilo(3, 6, [0, 1], [2, 2, 1])]
+    assert unchunk(wilo_chunks(3, 6, [0, 1], [2, 2, 1], 7)) == w
+    assert unchunk(wilo_chunks(3, 6, [0, 1], [2, 2, 1])) == w
+    assert not unchunk(wilo_chunks(3, 6, [2, 2, 1], [0, 1]))
+    chunks = wilo_chunks(2, 3, [], [1, 1, 1], 2)
+    assert chunks.chunk_size() == 2
+    offsets, letters = chunks.next(3)
+    assert offsets.tolist() == [0, 0, 1, 3]
+    assert letters.tolist() == [0, 0, 0]
+    assert len(unchunk(chunks)) == 4
+    assert chunks.exhausted()
+
+
+def test_split():
+    for n, upper_bound, first, last in (
+        (3, 6, [], [2, 2, 2, 2, 2, 2]),
+        (3, 6, [0, 1], [2, 2, 1]),
+        (2, 5, [1, 0, 1], [1, 1]),
+        (1, 5, [], [0, 0, 0, 0, 0]),
+    ):
+        w = [list(x) for x in wilo(n, upper_bound, first, last)]
+        for k in range(upper_bound):
+            ranges = wilo_split(n, upper_bound, first, last, k)
+            assert len(ranges) <= n**k
+            u = []
+            for x, y in ranges:
+                v = [list(z) for z in wilo(n, upper_bound, x, y)]
+                assert v
+                assert all(z[:k] == v[-1][:k] for z in v if len(z) >= k)
+                u.extend(v)
+            assert u == w
+    assert wilo_split(2, 3, [], [1, 1, 1], 1) == [([], [1]), ([1], [1, 1, 1])]
+    with pytest.raises(RuntimeError):
+        wilo_split(2, 3, [], [1, 1, 1], 3)
@@ -11,7 +11,13 @@
 This module contains some functions used in tests for wislo.
 """
 
-from libsemigroups_pybind11 import wislo, number_of_words
+from chunks import unchunk
+from libsemigroups_pybind11 import (
+    number_of_words,
+    wislo,
+    wislo_chunks,
+    wislo_split,
+)
 
 
 def test_000():
@@ -99,3 +105,35 @@ def test_003():
     w = list(wislo(3, first, last))
     assert len(w) == 797161
     assert len(w) == number_of_words(3, 0, 13)
+
+
+def test_chunks():
+    w = [list(x) for x in wislo(3, [0, 1], [2, 2, 1, 0])]
+    assert unchunk(wislo_chunks(3, [0, 1], [2, 2, 1, 0], 7)) == w
+    assert unchunk(wislo_chunks(3, [0, 1], [2, 2, 1, 0])) == w
+    w = unchunk(wislo_chunks(2, [], [0] * 11))
+    assert len(w) == number_of_words(2, 0, 11)
+
+
+def test_split():
+    for n, first, last in (
+        (3, [], [0, 0, 0, 0, 0]),
+        (3, [0, 1], [2, 2, 1, 0]),
+        (2, [1, 0, 1], [1, 1, 1, 0, 1]),
+        (1, [], [0, 0, 0, 0, 0]),
+    ):
+        w = [list(x) for x in wislo(n, first, last)]
+        for k in range(5):
+            u = []
+            for x, y in wislo_split(n, first, last, k):
+                v = [list(z) for z in wislo(n, x, y)]
+                assert v
+                assert all(len(z) == len(v[0]) for z in v)
+                assert all(z[:k] == v[0][:k] for z in v)
+                u.extend(v)
+            assert u == w
+    assert wislo_split(2, [], [0, 0], 1) == [
+        ([], [0]),
+        ([0], [1]),
+        ([1], [0, 0]),
+    ]
@@ -9,10 +9,12 @@
 # pylint: disable=missing-function-docstring
 
 """
-This module contains some tests for number_of_words.
+This module contains some tests for number_of_words and Word.
 """
 
-from libsemigroups_pybind11 import number_of_words
+import numpy as np
+import pytest
+from libsemigroups_pybind11 import KnuthBendix, Word, number_of_words, wislo
 
 
 def test_000():
@@ -23,3 +25,55 @@ def test_000():
     assert number_of_words(2, 4, 1) == 0
     assert number_of_words(2, 4, 4) == 0
     assert number_of_words(2, 4, 2) == 0
+
+
+def test_word():
+    w = Word([0, 1, 2, 1])
+    assert len(w) == 4
+    assert w.itemsize() == 1
+    assert w.letters() == [0, 1, 2, 1]
+    assert list(w) == [0, 1, 2, 1]
+    assert w[1] == 1
+    assert w[-1] == 1
+    with pytest.raises(IndexError):
+        w[4]  # pylint: disable=pointless-statement
+    assert w == [0, 1, 2, 1]
+    assert w != [0, 1, 2]
+    assert w == Word(np.array([0, 1, 2, 1]))
+    assert hash(w) == hash(Word([0, 1, 2, 1]))
+    assert repr(w) == "Word([0, 1, 2, 1])"
+
+    assert Word([256]).itemsize() == 2
+    assert Word([2**16]).itemsize() == 4
+    assert Word([2**32]).itemsize() == 8
+    assert Word([]).itemsize() == 1
+
+    a = np.asarray(Word([0, 300, 2]))
+    assert a.dtype == np.uint16
+    assert a.tolist() == [0, 300, 2]
+    assert not a.flags.writeable
+    assert memoryview(Word([1, 2])).tolist() == [1, 2]
+
+    with pytest.raises(TypeError):
+        Word([-1])
+    with pytest.raises(TypeError):
+        Word(np.array([0, -1]))
+    with pytest.raises(TypeError):
+        Word(b"ab")
+
+
+def test_word_arguments():
+    kb = KnuthBendix()
+    kb.set_alphabet(2)
+    kb.add_rule([0, 0, 0], [0])
+    kb.add_rule(Word([1, 1]), np.array([1], dtype=np.uint8))
+    kb.add_rule(np.array([0, 1]), np.array([1, 0], dtype=np.int32))
+    assert kb.size() == 5
+    assert kb.normal_form(Word([1, 0, 1])) == kb.normal_form([1, 0, 1])
+    assert kb.equal_to(np.array([0, 0, 0, 1]), Word([0, 1]))
+    assert list(wislo(2, Word([0]), np.array([1, 1]))) == list(
+        wislo(2, [0], [1, 1])
+    )
+    # Non-contiguous arrays
+    a = np.array([0, 9, 1, 9, 0, 9], dtype=np.uint64)[::2]
+    assert kb.normal_form(a) == kb.normal_form([0, 1, 0])